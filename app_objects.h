@@ -39,7 +39,7 @@ typedef struct {
     uint8_t  cpuPercent;    // Computed CPU %
 } TaskCpuInfo;
 
-TaskCpuInfo gTaskCpuInfo[MAX_TASKS];
+extern TaskCpuInfo gTaskCpuInfo[MAX_TASKS];
 
 typedef struct {
     uint32_t allocated;  // words given to xTaskCreate
@@ -47,7 +47,18 @@ typedef struct {
     uint32_t used;       // derived: allocated - highWater
 } StackInfo;
 
-StackInfo stackInput;
-StackInfo stackSnake;
-StackInfo stackRender;
-StackInfo stackMonitor;
+// Snek step period stats for one speed level (see Timing_PeriodTick)
+typedef struct {
+    uint32_t avgPeriodUs;
+    uint32_t minPeriodUs;
+    uint32_t maxPeriodUs;
+    uint32_t maxJitterUs;   // largest |period - expected|
+    int32_t  lastJitterUs;
+    uint32_t periods;       // samples behind the numbers
+} LevelTiming;
+
+extern StackInfo stackInput;
+extern StackInfo stackSnake;
+extern StackInfo stackRender;
+extern StackInfo stackMonitor;
+extern StackInfo stackTimer;     // timer service task: chrono and buzzer callbacks
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game_engine.h"
+
+// Autopilot: picks the next Direction for a GameEngine.
+//
+//  1. PATH: breadth-first search from the head to the fruit. The move is
+//     only taken if the tail can still be reached from the cell it leads
+//     to, so eating does not box the snek in.
+//  2. TAIL: otherwise follow the shortest path to the tail, which keeps
+//     opening up as the snek moves.
+//  3. SAFE: otherwise any move that does not hit the body this tick.
+//
+// Playing safe can go round in circles forever when the fruit never looks
+// safe, so after 2 * kCells ticks without eating the fruit path is taken
+// without the tail check.
+//
+// The searches are time-aware: body segment i (0 = head) leaves its cell
+// after len - i ticks, so a cell counts as open if the path reaches it no
+// sooner than that. Growth from eating on the way is ignored.
+//
+// Every search checks a caller-supplied microsecond clock every few nodes
+// and gives up once the per-tick budget is spent, dropping to the next
+// cheaper stage. All working storage is sized from Cfg at compile time and
+// lives in the object (no allocation, nothing big on the task stack).
+
+#ifndef AUTOPILOT_BUDGET_US
+#define AUTOPILOT_BUDGET_US 2000u   // per decision; the snek period is 69 ms
+#endif
+
+#define AUTOPILOT_CHECK_EVERY 16u   // nodes between clock reads
+
+enum AutopilotMode { AUTO_PATH, AUTO_TAIL, AUTO_SAFE };
+
+// Decision timing, readable in the debugger
+typedef struct {
+    uint32_t decisions;
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint32_t overBudget;   // decisions where a search ran out of time
+    uint8_t  mode;         // AutopilotMode of the last decision
+} AutopilotStats;
+
+template <class Cfg>
+class Autopilot {
+public:
+    typedef GameEngine<Cfg>         Game;
+    typedef typename Cfg::CellIndex CellIndex;
+    typedef typename Cfg::Length    Length;
+    typedef uint32_t (*Clock)(void);
+
+    Autopilot(Clock clock, uint32_t budgetUs = AUTOPILOT_BUDGET_US)
+        : now(clock), budget(budgetUs), lastScore(0), hungry(0)
+    {
+        resetStats();
+    }
+
+    void resetStats(void)
+    {
+        stat.decisions  = 0;
+        stat.lastUs     = 0;
+        stat.maxUs      = 0;
+        stat.overBudget = 0;
+        stat.mode       = AUTO_SAFE;
+    }
+
+    const AutopilotStats& stats(void) const { return stat; }
+
+    Direction decide(const Game& game);
+
+private:
+    enum { kNotFound = 4, kOutOfTime = 5 };
+
+    static CellIndex cellOf(typename Game::Position p) { return Game::cellOf(p.x, p.y); }
+    static CellIndex neighbor(CellIndex cell, uint8_t dir);
+
+    uint8_t search(CellIndex from, uint32_t t0, CellIndex target);
+    bool    outOfTime(void) const { return (uint32_t)(now() - start) > budget; }
+
+    Clock    now;
+    uint32_t budget;
+    uint32_t start;
+    bool     expired;
+    Length   lastScore;
+    uint32_t hungry;       // decisions since the score last changed
+    AutopilotStats stat;
+
+    // Ticks until each cell is free (0 = free now)
+    Length    freeAt[Cfg::kCells];
+    // BFS frontier and, per reached cell, the first move of its path
+    CellIndex queue[Cfg::kCells];
+    uint8_t   firstDir[Cfg::kCells];
+    uint32_t  seen[Cfg::kOccWords];
+};
+
+template <class Cfg>
+inline typename Cfg::CellIndex Autopilot<Cfg>::neighbor(CellIndex cell, uint8_t dir)
+{
+    uint32_t x = cell % Cfg::kWidth;
+    uint32_t y = cell / Cfg::kWidth;
+    switch (dir) {
+        case UP:    y = (y == 0) ? Cfg::kHeight - 1 : y - 1; break;
+        case DOWN:  y = (y == Cfg::kHeight - 1) ? 0 : y + 1; break;
+        case LEFT:  x = (x == 0) ? Cfg::kWidth - 1 : x - 1; break;
+        case RIGHT: x = (x == Cfg::kWidth - 1) ? 0 : x + 1; break;
+    }
+    return (CellIndex)(y * Cfg::kWidth + x);
+}
+
+// Shortest path from `from` (reached at tick t0) to target. Returns the
+// first Direction of the path, kNotFound, or kOutOfTime.
+template <class Cfg>
+uint8_t Autopilot<Cfg>::search(CellIndex from, uint32_t t0, CellIndex target)
+{
+    for (uint32_t w = 0; w < Cfg::kOccWords; ++w) seen[w] = 0;
+    seen[from >> 5] |= 1u << (from & 31);
+
+    uint32_t head = 0, tail = 0;
+    uint32_t layerEnd = 0;       // queue index where the current layer ends
+    uint32_t t = t0;             // tick at which the current layer is reached
+    queue[tail++] = from;
+    uint32_t popped = 0;
+
+    while (head < tail) {
+        if (head == layerEnd) {
+            layerEnd = tail;
+            t++;
+        }
+        if (++popped % AUTOPILOT_CHECK_EVERY == 0 && outOfTime()) {
+            expired = true;
+            return kOutOfTime;
+        }
+
+        CellIndex c = queue[head++];
+        for (uint8_t d = 0; d < 4; ++d) {
+            CellIndex n = neighbor(c, d);
+            uint32_t bit = 1u << (n & 31);
+            if (seen[n >> 5] & bit) continue;
+            if (freeAt[n] > t) continue;          // body still there when we arrive
+            seen[n >> 5] |= bit;
+            firstDir[n] = (c == from) ? d : firstDir[c];
+            if (n == target) return firstDir[n];
+            queue[tail++] = n;
+        }
+    }
+    return kNotFound;
+}
+
+template <class Cfg>
+Direction Autopilot<Cfg>::decide(const Game& game)
+{
+    start   = now();
+    expired = false;
+
+    if (game.score() != lastScore) {
+        lastScore = game.score();
+        hungry    = 0;
+    } else {
+        hungry++;
+    }
+
+    for (uint32_t c = 0; c < Cfg::kCells; ++c) freeAt[c] = 0;
+    Length len = game.length();
+    for (Length i = 0; i < len; ++i) {
+        freeAt[cellOf(game.segment(i))] = (Length)(len - i);
+    }
+
+    CellIndex headCell = cellOf(game.headPos());
+    CellIndex tailCell = cellOf(game.segment((Length)(len - 1)));
+    uint8_t dir = kNotFound;
+    uint8_t mode = AUTO_SAFE;
+
+    if (game.hasFruit()) {
+        uint8_t d = search(headCell, 0, cellOf(game.fruitPos()));
+        CellIndex next = (d < 4) ? neighbor(headCell, d) : headCell;
+        if (d < 4 && (next == tailCell || hungry >= 2 * Cfg::kCells ||
+                      search(next, 1, tailCell) < 4)) {
+            dir  = d;
+            mode = AUTO_PATH;
+        }
+    }
+    if (dir == kNotFound && !expired) {
+        uint8_t d = search(headCell, 0, tailCell);
+        if (d < 4) {
+            dir  = d;
+            mode = AUTO_TAIL;
+        }
+    }
+    if (dir >= 4) {
+        // Any move that is open next tick, current heading first
+        dir = game.direction();
+        for (uint8_t k = 0; k < 4; ++k) {
+            uint8_t d = (uint8_t)((game.direction() + k) & 3);
+            if (freeAt[neighbor(headCell, d)] <= 1) {
+                dir = d;
+                break;
+            }
+        }
+        mode = AUTO_SAFE;
+    }
+
+    uint32_t us = now() - start;
+    stat.decisions++;
+    stat.lastUs = us;
+    if (us > stat.maxUs) stat.maxUs = us;
+    if (expired) stat.overBudget++;
+    stat.mode = mode;
+    return (Direction)dir;
+}
@@ -10,33 +10,52 @@ extern "C" {
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
+#include "timers.h"
 }
 
-// TODO: Implement the buzzer task
-// This task should:
-// 1. Wait for events from the queue
-// 2. Start PWM with correct frequency
-// 3. Wait for specified duration
-// 4. Stop PWM
-static void vBuzzerTask(void* pvParameters)
+// Internal functions
+static void Buzzer_TimerCallback(TimerHandle_t xTimer);
+static void Buzzer_HWInit(void);
+static void Buzzer_Start(uint32_t freq_hz);
+static void Buzzer_Stop(void);
+
+static QueueHandle_t gBuzzerQ;          // const BuzzerNote* per melody
+static TimerHandle_t gBuzzerTimer;      // one-shot, fires when a note ends
+static const BuzzerNote* gNote = NULL;  // note playing, NULL when idle
+static bool gBuzzerIdle = true;         // timer stopped; the next Play kicks it
+
+volatile uint32_t gBuzzerPlays   = 0;
+volatile uint32_t gBuzzerDropped = 0;
+volatile uint32_t gBuzzerSteps   = 0;
+
+// Runs on the timer service task when the current note is over (or on the
+// kick from Buzzer_Play): start the next note, or the next queued melody,
+// and rearm for its duration. Never blocks. The service task outranks
+// every task that plays, so nothing is queued between the empty receive
+// and marking the buzzer idle.
+static void Buzzer_TimerCallback(TimerHandle_t xTimer)
 {
-    (void)pvParameters;
-
-    BuzzerEvent cmd;
-    
-
-    for (;;)
-    {   
-        if (xQueueReceive(gBuzzerQ, &cmd, portMAX_DELAY) == pdPASS)
-        {
-            if (cmd.freq_hz > 0 && cmd.duration_ms > 0)
-            {
-                Buzzer_Start(cmd.freq_hz);
-                vTaskDelay(pdMS_TO_TICKS(cmd.duration_ms));
-                Buzzer_Stop();
-            }
+    gBuzzerSteps++;
+
+    if (gNote != NULL) gNote++;
+    if (gNote == NULL || gNote->duration_ms == 0) {
+        if (xQueueReceive(gBuzzerQ, &gNote, 0) != pdPASS) {
+            gNote = NULL;
+            Buzzer_Stop();
+            gBuzzerIdle = true;
+            return;
         }
     }
+
+    if (gNote->freq_hz > 0) {
+        Buzzer_Start(gNote->freq_hz);
+    } else {
+        Buzzer_Stop();
+    }
+
+    TickType_t ticks = pdMS_TO_TICKS(gNote->duration_ms);
+    if (ticks == 0) ticks = 1;
+    xTimerChangePeriod(xTimer, ticks, 0);
 }
 
 // TODO: Implement hardware initialization
@@ -76,26 +95,41 @@ static void Buzzer_Stop(void)
     PWMOutputState(BUZZER_PWM_BASE, BUZZER_OUTBIT, false);
 }
 
-// TODO: Initialize complete buzzer subsystem
-// 1. Initialize hardware (GPIO + PWM)
-// 2. Create queue for events
-// 3. Create and start buzzer task
+// Initialize hardware (GPIO + PWM), the melody queue and the note timer.
+// The timer stays dormant until something is played.
 void Buzzer_Init(void)
 {
     Buzzer_HWInit();
-    gBuzzerQ = xQueueCreate(10, sizeof(BuzzerEvent));
-    xTaskCreate(vBuzzerTask, "Buzzer", 256, NULL, 2, NULL);
+    gBuzzerQ = xQueueCreate(BUZZER_QUEUE_LEN, sizeof(const BuzzerNote*));
+    gBuzzerTimer = xTimerCreate("Buzzer", 1, pdFALSE, NULL, Buzzer_TimerCallback);
+    if (gBuzzerQ == NULL || gBuzzerTimer == NULL) {
+        while(1);  // Creation failed - halt system
+    }
 }
 
-// TODO: Post sound event to queue (non-blocking)
-// Create event struct and send to queue
-void Buzzer_Post(uint32_t freq, uint32_t durationMs)
+// Queue a melody (non-blocking) and wake the timer if nothing is playing.
+// The melody must stay valid until it has played: keep it const.
+bool Buzzer_Play(const BuzzerNote* melody)
 {
-    BuzzerEvent cmd = { freq, durationMs };
-    
-    if (xQueueSend(gBuzzerQ, &cmd, 0) == pdPASS) {
+    if (melody == NULL || melody->duration_ms == 0) return false;
+
+    if (xQueueSend(gBuzzerQ, &melody, 0) != pdPASS) {
+        taskENTER_CRITICAL();
+        gBuzzerDropped++;
+        taskEXIT_CRITICAL();
+        return false;
+    }
 
-        (void)xQueueSend(gBuzzerQ, &cmd, 0);
+    taskENTER_CRITICAL();
+    gBuzzerPlays++;
+    bool kick = gBuzzerIdle;
+    gBuzzerIdle = false;
+    taskEXIT_CRITICAL();
 
+    // Timer command queue full: leave it idle, the melody plays after the
+    // next one that gets through
+    if (kick && xTimerChangePeriod(gBuzzerTimer, 1, 0) != pdPASS) {
+        gBuzzerIdle = true;
     }
+    return true;
 }
@@ -12,21 +12,24 @@
 #define BUZZER_GPIO_BASE   GPIO_PORTF_BASE
 #define BUZZER_GPIO_PIN    GPIO_PIN_1
 
-// Buzzer event structure sent via queue
+// One note of a melody. freq_hz 0 is a rest; duration_ms 0 ends the
+// melody. A melody is a const array of these ending in BUZZER_END, kept
+// in flash and posted by pointer, so a whole jingle is one queue entry.
 typedef struct {
-    uint32_t freq_hz;  // Hz
-    uint32_t duration_ms;   // milliseconds
-} BuzzerEvent;
+    uint16_t freq_hz;       // Hz, 0 = silent
+    uint16_t duration_ms;   // milliseconds
+} BuzzerNote;
 
-// Q variable
-static QueueHandle_t gBuzzerQ;
+#define BUZZER_END { 0, 0 }
+
+// Melodies waiting behind the one playing
+#define BUZZER_QUEUE_LEN 4
 
 // Public API functions
 void Buzzer_Init(void);
-void Buzzer_Post(uint32_t freq, uint32_t durationMs);
+bool Buzzer_Play(const BuzzerNote* melody);  // false if the queue is full
 
-// Internal functions (implement these)
-static void vBuzzerTask(void* pvParameters);
-static void Buzzer_HWInit(void);
-static void Buzzer_Start(uint32_t freq_hz);
-static void Buzzer_Stop(void);
+// Traffic, readable in the debugger
+extern volatile uint32_t gBuzzerPlays;     // melodies queued
+extern volatile uint32_t gBuzzerDropped;   // melodies lost to a full queue
+extern volatile uint32_t gBuzzerSteps;     // timer callbacks (note starts and stops)
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+
+// Text building for the HUD and debug overlay without printf. Each call
+// appends at p and returns the new end; Digits_End terminates the string.
+// The caller sizes the buffer (10 digits is the most a uint32_t needs).
+
+static inline char* Digits_Str(char* p, const char* s)
+{
+    while (*s) *p++ = *s++;
+    return p;
+}
+
+// v in exactly `width` digits, zero padded; higher digits are dropped
+static inline char* Digits_Pad(char* p, uint32_t v, uint8_t width)
+{
+    for (uint8_t i = width; i-- > 0; ) {
+        p[i] = (char)('0' + v % 10u);
+        v /= 10u;
+    }
+    return p + width;
+}
+
+static inline char* Digits_U32(char* p, uint32_t v)
+{
+    char tmp[10];
+    uint8_t n = 0;
+    do {
+        tmp[n++] = (char)('0' + v % 10u);
+        v /= 10u;
+    } while (v);
+    while (n) *p++ = tmp[--n];
+    return p;
+}
+
+static inline char* Digits_I32(char* p, int32_t v)
+{
+    if (v < 0) {
+        *p++ = '-';
+        return Digits_U32(p, 0u - (uint32_t)v);
+    }
+    return Digits_U32(p, (uint32_t)v);
+}
+
+static inline void Digits_End(char* p)
+{
+    *p = '\0';
+}
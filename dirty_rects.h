@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Small list of screen rectangles touched since the last flush. Adding a
+// rectangle merges it into an existing one when the union wastes few
+// pixels, since every separate rectangle costs a window setup on the
+// panel. When the list is full the new one goes into whichever rectangle
+// grows least. No hardware access, so it also runs on a host.
+
+#define DIRTY_MAX_RECTS  8
+#define DIRTY_MERGE_SLACK 16   // extra pixels worth sending to save a window setup
+
+typedef struct {
+    int16_t x0, y0, x1, y1;    // inclusive
+} DirtyRect;
+
+typedef struct {
+    DirtyRect rects[DIRTY_MAX_RECTS];
+    uint8_t   count;
+    int16_t   width, height;   // screen size, for clipping
+} DirtyList;
+
+static inline uint32_t DirtyRect_Area(const DirtyRect* r)
+{
+    return (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+}
+
+static inline DirtyRect DirtyRect_Union(const DirtyRect* a, const DirtyRect* b)
+{
+    DirtyRect u;
+    u.x0 = (a->x0 < b->x0) ? a->x0 : b->x0;
+    u.y0 = (a->y0 < b->y0) ? a->y0 : b->y0;
+    u.x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    u.y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+    return u;
+}
+
+static inline void Dirty_Init(DirtyList* list, int16_t width, int16_t height)
+{
+    list->count  = 0;
+    list->width  = width;
+    list->height = height;
+}
+
+static inline void Dirty_Clear(DirtyList* list)
+{
+    list->count = 0;
+}
+
+static inline void Dirty_Add(DirtyList* list, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    // Clip to the screen; nothing left means nothing to send
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > list->width - 1)  x1 = list->width - 1;
+    if (y1 > list->height - 1) y1 = list->height - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    DirtyRect r = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1 };
+    uint32_t area = DirtyRect_Area(&r);
+
+    // Cheapest rectangle to grow, and whether that is nearly free
+    int8_t   best = -1;
+    uint32_t bestCost = 0xFFFFFFFFu;
+    for (uint8_t i = 0; i < list->count; ++i) {
+        DirtyRect u  = DirtyRect_Union(&list->rects[i], &r);
+        uint32_t grow = DirtyRect_Area(&u) - DirtyRect_Area(&list->rects[i]);
+        uint32_t cost = (grow > area) ? grow - area : 0;   // pixels sent for nothing
+        if (cost < bestCost) {
+            bestCost = cost;
+            best = (int8_t)i;
+        }
+    }
+
+    if (best >= 0 && (bestCost <= DIRTY_MERGE_SLACK || list->count == DIRTY_MAX_RECTS)) {
+        list->rects[best] = DirtyRect_Union(&list->rects[best], &r);
+    } else {
+        list->rects[list->count++] = r;
+    }
+}
+
+// Pixels a flush of the list would send
+static inline uint32_t Dirty_Pixels(const DirtyList* list)
+{
+    uint32_t n = 0;
+    for (uint8_t i = 0; i < list->count; ++i) n += DirtyRect_Area(&list->rects[i]);
+    return n;
+}
@@ -3,13 +3,17 @@
 #include <string.h>
 
 extern "C" {
-#include "Crystalfontz128x128_ST7735.h"
 #include "grlib/grlib.h"
 
 }
 
 #include "app_objects.h"
 #include "game.h"
+#include "lcd_dirty.h"
+#include "tiles.h"
+#include "digits.h"
+#include "screen_art.h"
+#include "render_profile.h"
 
 // External timing measurement variables from main.cpp
 extern volatile uint32_t gAvgPeriodUs;
@@ -17,6 +21,7 @@ extern volatile int32_t  gLastJitterSnapshot;
 extern volatile uint32_t gAvgExecUs;
 extern volatile uint32_t gMaxExecUs;
 extern volatile uint32_t gCurrentFPS;
+extern LevelTiming gLevelTiming[SPEED_LEVELS];
 
 // game time
 extern volatile uint32_t gameTimeMs;
@@ -33,180 +38,773 @@ extern uint8_t gNumTasks;
 
 // Declare the formatting function
 extern void FormatGameTime(char* buffer, size_t bufSize, uint32_t timeMs);
+extern uint32_t micros(void);
 
-void LCD_Init(void)
-{
-    Crystalfontz128x128_Init();
-    Crystalfontz128x128_SetOrientation(LCD_ORIENTATION_UP);
-    GrContextInit(&gContext, &g_sCrystalfontz128x128);
-    GrContextFontSet(&gContext, &g_sFontFixed6x8);
+static void composeScreen(void (*compose)(void));
 
+static void composeClear(void)
+{
     tRectangle full = {0, 0, 127, 127};
     GrContextForegroundSet(&gContext, ClrBlack);
     GrRectFill(&gContext, &full);
-#ifdef GrFlush
-    GrFlush(&gContext);
+}
+
+void LCD_Init(void)
+{
+    LCD_PanelInit();
+    // Draw through the dirty-rect wrapper so flushes only send what changed
+    GrContextInit(&gContext, &g_sSnekDisplay);
+    GrContextFontSet(&gContext, &g_sFontFixed6x8);
+    composeScreen(composeClear);
+}
+
+// Pixels written by the fill/text helpers below. Text counts its whole
+// 6x8 glyph boxes, so this is an upper bound on what reaches the panel.
+volatile uint32_t gPixelsLastFrame = 0;
+static uint32_t framePixels = 0;
+
+static void fillRect(const tRectangle* r, uint32_t color)
+{
+    GrContextForegroundSet(&gContext, color);
+    GrRectFill(&gContext, r);
+    framePixels += (uint32_t)(r->i16XMax - r->i16XMin + 1) * (uint32_t)(r->i16YMax - r->i16YMin + 1);
+}
+
+static void drawText(const char* text, int32_t x, int32_t y)
+{
+    GrStringDraw(&gContext, text, -1, x, y, false);
+    framePixels += (uint32_t)strlen(text) * 6u * 8u;
+}
+
+// Incremental rendering: keep what every cell shows and only repaint the
+// cells that differ from the game (normally old tail, old head, new head
+// and fruit). Anything that invalidates the screen as a whole (reset,
+// rewind, replay start, kil/win screen, debug toggle, new debug stats)
+// falls back to a full redraw.
+bool gIncrementalRender = true;     // false: clear and redraw every frame
+
+// Strip mode: compose each frame LCD_STRIP_ROWS rows at a time and send
+// each strip before the next (see lcd_dirty.h), so no screen buffer is
+// needed. Only the strips that changed are composed, each one whole.
+// Built with LCD_STRIP_ONLY it is the only mode and the screen buffer is
+// not linked.
+#ifndef LCD_STRIP_ONLY
+bool gStripRender = false;
+#endif
+
+static inline bool stripMode(void)
+{
+#ifdef LCD_STRIP_ONLY
+    return true;
+#else
+    return gStripRender;
 #endif
 }
 
-static inline void drawCell(uint8_t gx, uint8_t gy, uint32_t color)
+enum { CELL_EMPTY, CELL_BODY, CELL_HEAD, CELL_FRUIT };
+static const uint32_t kCellColor[4] = { ClrBlack, ClrYellow, ClrGreen, ClrRed };
+
+// 8x8 cells are copied from kCellTiles; other cell sizes (and a frame
+// buffer the blit cannot use) fall back to a grlib fill
+static inline void drawCell(Coord gx, Coord gy, uint8_t kind)
 {
     // Convert grid cell to pixel rectangle
-    int16_t x0 = (int16_t)(gx * CELL_SIZE);
-    int16_t y0 = (int16_t)(gy * CELL_SIZE);
-    tRectangle r = { x0, y0, (int16_t)(x0 + CELL_SIZE - 1), (int16_t)(y0 + CELL_SIZE - 1) };
-    GrContextForegroundSet(&gContext, color);
-    GrRectFill(&gContext, &r);
+    int16_t x0 = (int16_t)(gx * BoardConfig::kCellSize);
+    int16_t y0 = (int16_t)(gy * BoardConfig::kCellSize);
+    if (BoardConfig::kCellSize == TILE_SIZE && LCD_BlitTile8(x0, y0, &kCellTiles[kind])) {
+        framePixels += TILE_SIZE * TILE_SIZE;
+        return;
+    }
+    tRectangle r = { x0, y0, (int16_t)(x0 + BoardConfig::kCellSize - 1), (int16_t)(y0 + BoardConfig::kCellSize - 1) };
+    fillRect(&r, kCellColor[kind]);
 }
 
-void DrawGame(const snekGameState* state)
+// Score/high score text covers the top rows of the board, rounded up to
+// whole cells here
+#define HUD_TEXT_BOTTOM 19
+#define HUD_CELL_ROWS   ((HUD_TEXT_BOTTOM + BoardConfig::kCellSize) / BoardConfig::kCellSize)
+#define DEBUG_TOP       22          // first pixel row of the debug overlay
+
+// DrawGame's time per phase this frame, for render_profile. phaseEnd()
+// books the time since the previous mark to a phase. It reads the timer,
+// so it is called once per phase, never per cell: the fruit cell is drawn
+// after the body cells to keep the two phases apart.
+static uint32_t phaseUs[RENDER_PHASES];
+static uint32_t phaseMark;
+
+static inline void phaseEnd(uint8_t phase)
 {
-    (void)state; // not used for minimal version yet
+    uint32_t now = micros();
+    phaseUs[phase] += now - phaseMark;
+    phaseMark = now;
+}
 
-    // Clear background
-    tRectangle full = {0, 0, 127, 127};
-    GrContextForegroundSet(&gContext, ClrBlack);
-    GrRectFill(&gContext, &full);
+static uint8_t  wantCells[BoardConfig::kCells];
+static uint32_t fruitCell;          // index in wantCells, kCells if none
+static uint8_t  shownCells[BoardConfig::kCells];
+static bool     shownValid = false;
+static bool     shownDebug = false;
+static bool     shownStrip = false;
+static uint32_t shownSeed = 0;
+static uint32_t shownTicks = 0;
+
+extern volatile uint32_t gStatsSeq;
 
-    // Draw snek
-    for (uint8_t i = 0; i < snekLength; ++i) {
-        drawCell(snek[i].x, snek[i].y, i == 0 ? ClrGreen : ClrYellow);
+// Frame being drawn and the game it holds, unpacked. Only the render task
+// touches these; the snek task keeps stepping gGame meanwhile.
+static const RenderFrame* frame;
+static SnekGame view;
+
+// Force the next DrawGame() to repaint everything
+void InvalidateGameScreen(void)
+{
+    shownValid = false;
+}
+
+static void buildWantCells(void)
+{
+    memset(wantCells, CELL_EMPTY, sizeof(wantCells));
+    for (SnekLength i = view.length(); i-- > 0; ) {
+        Position p = view.segment(i);
+        wantCells[SnekGame::cellOf(p.x, p.y)] = (i == 0) ? CELL_HEAD : CELL_BODY;
+    }
+    fruitCell = BoardConfig::kCells;
+    if (view.hasFruit()) {
+        Position fruit = view.fruitPos();
+        fruitCell = SnekGame::cellOf(fruit.x, fruit.y);
+        wantCells[fruitCell] = CELL_FRUIT;
     }
+}
 
-    // Draw fruit (if exists)
-    if (hasFruit) {
-        drawCell(fruit.x, fruit.y, ClrRed);
+// HUD fields. Each owns a fixed box in the top rows and is repainted
+// (box, the cells under it, then its text clipped to the box) only when
+// its value changes or a cell under it was redrawn.
+enum { HUD_SCORE, HUD_HIGH, HUD_CHRONO, HUD_MODE, HUD_FIELDS };
+static const tRectangle kHudBox[HUD_FIELDS] = {
+    {  0,  0,  77, 10 },    // "Score: N LN", cut off where the chrono starts
+    {  0, 11,  91, HUD_TEXT_BOTTOM },   // "High Score: N"
+    { 78,  0, 127, 10 },    // chrono, opaque over the board
+    { 92, 11, 127, HUD_TEXT_BOTTOM },   // REPLAY / AUTO
+};
+static const tRectangle kScreen = { 0, 0, 127, 127 };
+static uint32_t shownHud[HUD_FIELDS];
+
+// Where drawing can land: the screen, or the strip being composed
+static tRectangle area = kScreen;
+
+static bool intersect(const tRectangle* a, const tRectangle* b, tRectangle* out)
+{
+    out->i16XMin = (a->i16XMin > b->i16XMin) ? a->i16XMin : b->i16XMin;
+    out->i16YMin = (a->i16YMin > b->i16YMin) ? a->i16YMin : b->i16YMin;
+    out->i16XMax = (a->i16XMax < b->i16XMax) ? a->i16XMax : b->i16XMax;
+    out->i16YMax = (a->i16YMax < b->i16YMax) ? a->i16YMax : b->i16YMax;
+    return out->i16XMin <= out->i16XMax && out->i16YMin <= out->i16YMax;
+}
+
+static uint32_t hudValue(uint8_t field)
+{
+    switch (field) {
+    case HUD_SCORE:  return ((uint32_t)view.score() << 8) | frame->speedLevel;
+    case HUD_HIGH:   return frame->highScore;
+    case HUD_CHRONO: return gameTimeMs / 10;      // shown to the centisecond
+    default:         return frame->isReplaying ? 1u : (frame->autopilot ? 2u : 0u);
     }
+}
 
-    // Draw score
-    char scoreText[16];
-    snprintf(scoreText, sizeof(scoreText), "Score: %u", score);
-    GrContextForegroundSet(&gContext, ClrWhite);
-    GrStringDraw(&gContext, scoreText, -1, 2, 2, false);
-    snprintf(scoreText, sizeof(scoreText), "High Score: %u", highScore);
-    GrContextForegroundSet(&gContext, ClrWhite);
-    GrStringDraw(&gContext, scoreText, -1, 2, 12, false);
+// Bit per HUD field whose box overlaps cell (gx, gy)
+static uint8_t hudFieldsOver(Coord gx, Coord gy)
+{
+    int16_t x0 = (int16_t)(gx * BoardConfig::kCellSize);
+    int16_t y0 = (int16_t)(gy * BoardConfig::kCellSize);
+    int16_t x1 = (int16_t)(x0 + BoardConfig::kCellSize - 1);
+    int16_t y1 = (int16_t)(y0 + BoardConfig::kCellSize - 1);
+    uint8_t mask = 0;
+    for (uint8_t f = 0; f < HUD_FIELDS; ++f) {
+        const tRectangle* b = &kHudBox[f];
+        if (x0 <= b->i16XMax && x1 >= b->i16XMin && y0 <= b->i16YMax && y1 >= b->i16YMin) {
+            mask |= (uint8_t)(1u << f);
+        }
+    }
+    return mask;
+}
 
-    //     Top timer bar
-    char timeString[12];
-    FormatGameTime(timeString, sizeof(timeString), gameTimeMs);
-    tRectangle chronoArea = {78, 0, 127, 10};
-    GrContextForegroundSet(&gContext, ClrBlack);
-    GrRectFill(&gContext, &chronoArea);
-    GrContextForegroundSet(&gContext, ClrWhite);
-    GrStringDraw(&gContext, timeString, -1, 80, 2, false);
+// The parts of non-empty cells that fall inside box
+static void drawCellsIn(const tRectangle* box)
+{
+    Coord gx0 = (Coord)(box->i16XMin / BoardConfig::kCellSize);
+    Coord gx1 = (Coord)(box->i16XMax / BoardConfig::kCellSize);
+    Coord gy0 = (Coord)(box->i16YMin / BoardConfig::kCellSize);
+    Coord gy1 = (Coord)(box->i16YMax / BoardConfig::kCellSize);
+    for (Coord gy = gy0; gy <= gy1; ++gy) {
+        for (Coord gx = gx0; gx <= gx1; ++gx) {
+            uint8_t kind = wantCells[SnekGame::cellOf(gx, gy)];
+            if (kind == CELL_EMPTY) continue;
+            int16_t x0 = (int16_t)(gx * BoardConfig::kCellSize);
+            int16_t y0 = (int16_t)(gy * BoardConfig::kCellSize);
+            tRectangle r = {
+                (int16_t)((x0 > box->i16XMin) ? x0 : box->i16XMin),
+                (int16_t)((y0 > box->i16YMin) ? y0 : box->i16YMin),
+                (int16_t)((x0 + BoardConfig::kCellSize - 1 < box->i16XMax) ? x0 + BoardConfig::kCellSize - 1 : box->i16XMax),
+                (int16_t)((y0 + BoardConfig::kCellSize - 1 < box->i16YMax) ? y0 + BoardConfig::kCellSize - 1 : box->i16YMax)
+            };
+            fillRect(&r, kCellColor[kind]);
+        }
+    }
+}
 
-    if(debugMode){
-        //All Task Manager Display here
-        char fpsText[20];
-        snprintf(fpsText, sizeof(fpsText), "FPS:%lu", gCurrentFPS);
-        //
-        // char execText[30];
-        // snprintf(execText, sizeof(execText), "Ex:%lu/%lu us", gAvgExecUs, gMaxExecUs);
+static void drawHudField(uint8_t field)
+{
+    const tRectangle* box = &kHudBox[field];
+    fillRect(box, ClrBlack);
+    if (field != HUD_CHRONO) drawCellsIn(box);
+
+    char text[24];
+    char* p = text;
+    int32_t x = 2, y = 2;
+    uint32_t color = ClrWhite;
+    switch (field) {
+    case HUD_SCORE:
+        p = Digits_Str(p, "Score: ");
+        p = Digits_U32(p, view.score());
+        p = Digits_Str(p, " L");
+        p = Digits_U32(p, frame->speedLevel + 1u);
+        break;
+    case HUD_HIGH:
+        p = Digits_Str(p, "High Score: ");
+        p = Digits_U32(p, frame->highScore);
+        y = 12;
+        break;
+    case HUD_CHRONO:
+        FormatGameTime(text, sizeof(text), gameTimeMs);
+        p = text + strlen(text);
+        x = 80;
+        break;
+    default:
+        // Playing back gInputLog or steered by gAutopilot, not live input
+        color = ClrCyan;
+        y = 12;
+        if (frame->isReplaying) {
+            p = Digits_Str(p, "REPLAY");
+            x = 92;
+        } else if (frame->autopilot) {
+            p = Digits_Str(p, "AUTO");
+            x = 104;
+        }
+        break;
+    }
+    Digits_End(p);
+    tRectangle clip;
+    if (p == text || !intersect(box, &area, &clip)) return;
 
-        // // Display both metrics
-        // tRectangle hud = {0, 112, 127, 127};
-        // GrContextForegroundSet(&gContext, ClrBlack);
-        // GrRectFill(&gContext, &hud);
+    GrContextClipRegionSet(&gContext, &clip);
+    GrContextForegroundSet(&gContext, color);
+    drawText(text, x, y);
+    GrContextClipRegionSet(&gContext, &area);
+}
 
-        GrContextForegroundSet(&gContext, ClrWhite);
-        GrStringDraw(&gContext, fpsText, -1, 2, 112, false);        // FPS on first line
-        // GrStringDraw(&gContext, execText, -1, 2, 120, false);       // Execution time on second line
+static void drawHud(uint8_t fields)
+{
+    for (uint8_t f = 0; f < HUD_FIELDS; ++f) {
+        if (fields & (1u << f)) drawHudField(f);
+        shownHud[f] = hudValue(f);
+    }
+}
 
-        char cpuText[7][20];
-        char cpuTotal[20];
-        char tasks[10];
-        snprintf(cpuTotal, sizeof(cpuTotal), "Total CPU Util: %lu%%", gCpuUtil);
-        snprintf(tasks, sizeof(tasks), "Tasks: %lu", gNumTasks-1);
+// Debug overlay: the task manager text over the lower board. It is a layer
+// of its own: the lines are formatted only when MonitorTask publishes new
+// stats (gStatsSeq, every 2 s) or the speed level changes, and only lines
+// whose text changed are repainted. A board cell repainted under it gets
+// the overlay text back clipped to that cell.
+#define OVERLAY_LINES 13
+#define OVERLAY_CHARS 21            // 6-pixel glyphs across the screen
+typedef struct {
+    char     text[OVERLAY_CHARS + 1];
+    int16_t  x, y;
+    uint32_t color;
+} OverlayLine;
+
+static OverlayLine overlay[OVERLAY_LINES];
+static uint32_t overlaySeq = 0;
+static uint8_t  overlayLevel = 0xFF;
+static bool     overlayValid = false;
+
+// Text past OVERLAY_CHARS would be off screen anyway, so it is cut there
+static void setOverlayLine(OverlayLine* line, const char* text, int16_t y, uint32_t color)
+{
+    uint8_t n = 0;
+    while (n < OVERLAY_CHARS && text[n] != '\0') {
+        line->text[n] = text[n];
+        n++;
+    }
+    line->text[n] = '\0';
+    line->x     = 2;
+    line->y     = y;
+    line->color = color;
+}
+
+// Pixel box a line's text covers (6x8 glyphs)
+static tRectangle overlayBox(const OverlayLine* line)
+{
+    tRectangle r = { line->x, line->y,
+                     (int16_t)(line->x + 6 * (int16_t)strlen(line->text) - 1), (int16_t)(line->y + 7) };
+    if (r.i16XMax > 127) r.i16XMax = 127;
+    return r;
+}
 
-        GrStringDraw(&gContext, cpuTotal, -1, 2, 40, false);
-        GrStringDraw(&gContext, tasks, -1, 2, 48, false);
+// Format the stats into lines[OVERLAY_LINES]
+static void buildOverlay(OverlayLine* lines)
+{
+    //All Task Manager Display here
+    // FPS plus snek step jitter (last/worst) at the current speed level
+    char text[48];
+    const LevelTiming* lt = &gLevelTiming[frame->speedLevel];
+    char* p = Digits_Str(text, "FPS:");
+    p = Digits_U32(p, gCurrentFPS);
+    p = Digits_Str(p, " J:");
+    p = Digits_I32(p, lt->lastJitterUs / 1000);
+    *p++ = '/';
+    p = Digits_U32(p, lt->maxJitterUs / 1000);
+    Digits_End(p);
+    setOverlayLine(&lines[0], text, 112, ClrWhite);      // FPS on first line
+
+    p = Digits_Str(text, "Total CPU Util: ");
+    p = Digits_U32(p, gCpuUtil);
+    *p++ = '%';
+    Digits_End(p);
+    setOverlayLine(&lines[1], text, 40, ClrWhite);
+
+    p = Digits_Str(text, "Tasks: ");
+    p = Digits_U32(p, (uint32_t)(gNumTasks - 1));
+    Digits_End(p);
+    setOverlayLine(&lines[2], text, 48, ClrWhite);
+
+    /* 0 :   Monitor
+     * 1 :   IDLE 
+     * 2 :   Render / tmr svc
+     * 3 :   Input  / tmr svc
+     * 4 :   Render / Input
+     * 5 :   Snek
+     * (the buzzer runs on tmr svc; line 6 stays blank)
+     */
+    for (uint8_t i = 0; i < 7; i++){
+        if (i >= gNumTasks) {
+            setOverlayLine(&lines[3 + i], "", (int16_t)(56 + 8*i), ClrWhite);
+            continue;
+        }
+        p = Digits_Str(text, gTaskCpuInfo[i].name);   // name is at most 15 chars
+        *p++ = ' ';
+        p = Digits_U32(p, gTaskCpuInfo[i].cpuPercent);
+        *p++ = '%';
+        Digits_End(p);
+
+        uint32_t color = ClrWhite;
+        if (gTaskCpuInfo[i].cpuPercent > 80){
+            color = ClrRed;
+        } else if(gTaskCpuInfo[i].cpuPercent > 50){
+            color = ClrYellow;
+        }
+        setOverlayLine(&lines[3 + i], text, (int16_t)(56 + 8*i), color);
+    }
+
+    p = Digits_Str(text, "STK: S:");
+    p = Digits_U32(p, stackSnake.used);
+    p = Digits_Str(p, " R:");
+    p = Digits_U32(p, stackRender.used);
+    p = Digits_Str(p, " I:");
+    p = Digits_U32(p, stackInput.used);
+    Digits_End(p);
+    setOverlayLine(&lines[10], text, 120, ClrWhite);
+
+    // Average us per DrawGame phase, last window: Clear Body Fruit / HUD
+    // Overlay fLush (min, max and histograms are in gRenderProfile)
+    static const char kPhaseTag[RENDER_PHASES] = { 'C', 'B', 'F', 'H', 'O', 'L' };
+    for (uint8_t line = 0; line < 2; ++line) {
+        p = text;
+        for (uint8_t i = (uint8_t)(line * 3); i < line * 3 + 3; ++i) {
+            uint32_t us = gRenderProfile.phase[i].avgUs;
+            if (p != text) *p++ = ' ';
+            *p++ = kPhaseTag[i];
+            *p++ = ':';
+            p = Digits_U32(p, (us > 99999u) ? 99999u : us);
+        }
+        Digits_End(p);
+        setOverlayLine(&lines[11 + line], text, (int16_t)(22 + 8 * line), ClrWhite);
+    }
+}
 
+// Overlay text that falls inside clip, drawn over whatever is there
+static void drawOverlayIn(const tRectangle* clip)
+{
+    for (uint8_t i = 0; i < OVERLAY_LINES; ++i) {
+        tRectangle box = overlayBox(&overlay[i]);
+        tRectangle part;
+        if (!intersect(&box, clip, &part)) continue;
+        GrContextClipRegionSet(&gContext, &part);
+        GrContextForegroundSet(&gContext, overlay[i].color);
+        GrStringDraw(&gContext, overlay[i].text, -1, overlay[i].x, overlay[i].y, false);
+        framePixels += (uint32_t)(part.i16XMax - part.i16XMin + 1) * (uint32_t)(part.i16YMax - part.i16YMin + 1);
+    }
+    GrContextClipRegionSet(&gContext, &area);
+}
 
-        for (uint8_t i = 0; i < 7; i++){
-            snprintf(cpuText[i], sizeof(cpuText[i]), "%s %lu%%", gTaskCpuInfo[i].name, gTaskCpuInfo[i].cpuPercent);
+// Bit per strip that rows y0..y1 cross
+static uint32_t stripsOver(int16_t y0, int16_t y1)
+{
+    uint32_t bits = 0;
+    for (int16_t s = y0 / LCD_STRIP_ROWS; s <= y1 / LCD_STRIP_ROWS; ++s) bits |= 1u << s;
+    return bits;
+}
 
-            if (gTaskCpuInfo[i].cpuPercent > 80){
-                GrContextForegroundSet(&gContext, ClrRed);
-            } else if(gTaskCpuInfo[i].cpuPercent > 50){
-                GrContextForegroundSet(&gContext, ClrYellow);
-            } else {
-                GrContextForegroundSet(&gContext, ClrWhite);
-            }
+// Reformat after new stats and repaint the lines that changed: the box
+// of the old and new text, the cells under it, then the new text. With
+// strips given, mark the strips those boxes cross instead of painting.
+static void updateOverlay(uint32_t* strips)
+{
+    if (overlayValid && gStatsSeq == overlaySeq && frame->speedLevel == overlayLevel) return;
+
+    OverlayLine old[OVERLAY_LINES];
+    memcpy(old, overlay, sizeof(old));
+    buildOverlay(overlay);
+    overlaySeq   = gStatsSeq;
+    overlayLevel = frame->speedLevel;
+    if (!overlayValid) {
+        overlayValid = true;
+        return;             // first build; the caller draws it all
+    }
 
-            GrStringDraw(&gContext, cpuText[i], -1, 2, 56 + 8*i, false);
+    for (uint8_t i = 0; i < OVERLAY_LINES; ++i) {
+        if (old[i].color == overlay[i].color && strcmp(old[i].text, overlay[i].text) == 0) continue;
+        tRectangle a = overlayBox(&old[i]);
+        tRectangle b = overlayBox(&overlay[i]);
+        tRectangle box = { a.i16XMin, a.i16YMin,
+                           (a.i16XMax > b.i16XMax) ? a.i16XMax : b.i16XMax, a.i16YMax };
+        if (strips) {
+            *strips |= stripsOver(box.i16YMin, box.i16YMax);
+            continue;
         }
+        fillRect(&box, ClrBlack);
+        drawCellsIn(&box);
+        drawOverlayIn(&box);
+    }
+}
+
+// Pixels written last frame, after "Tasks". Repainted every frame (box,
+// cells under it, text) because it changes every frame while the text
+// around it only changes with new stats.
+static const tRectangle kPixelCountBox = { 62, 48, 127, 55 };
+
+static void drawPixelCount(void)
+{
+    char pxText[16];
+    Digits_End(Digits_U32(Digits_Str(pxText, "Px:"), gPixelsLastFrame));
+    fillRect(&kPixelCountBox, ClrBlack);
+    drawCellsIn(&kPixelCountBox);
+    GrContextForegroundSet(&gContext, ClrWhite);
+    drawText(pxText, 62, 48);
+}
 
-        /* 0 :   Monitor
-         * 1 :   IDLE 
-         * 2 :   Render / tmr svc
-         * 3 :   Input  / tmr svc
-         * 4 :   Render / Input
-         * 5 :   Snek
-         * 6 :   Buzzer
-         */
+static void beginStrip(int16_t y0)
+{
+    area.i16YMin = y0;
+    area.i16YMax = (int16_t)(y0 + LCD_STRIP_ROWS - 1);
+    GrContextClipRegionSet(&gContext, &area);
+    LCD_StripBegin(y0);
+}
 
-        char stkText[30];
-        snprintf(stkText, sizeof(stkText), "STK: S:%lu R:%lu I:%lu", stackSnake.used, stackRender.used, stackInput.used);
+static void endStrip(void)
+{
+    LCD_StripEnd();
+    area = kScreen;
+    GrContextClipRegionSet(&gContext, &kScreen);
+}
 
-        GrStringDraw(&gContext, stkText, -1, 2, 120, false);
+// One strip of the game screen, from scratch
+static void composeGameStrip(void)
+{
+    fillRect(&area, ClrBlack);
+    phaseEnd(PHASE_CLEAR);
+    for (Coord gy = (Coord)(area.i16YMin / BoardConfig::kCellSize);
+         gy <= area.i16YMax / BoardConfig::kCellSize && gy < BoardConfig::kHeight; ++gy) {
+        for (Coord gx = 0; gx < BoardConfig::kWidth; ++gx) {
+            uint8_t kind = wantCells[SnekGame::cellOf(gx, gy)];
+            if (kind == CELL_EMPTY || kind == CELL_FRUIT) continue;
+            drawCell(gx, gy, kind);
+        }
+    }
+    phaseEnd(PHASE_BODY);
+    if (fruitCell < BoardConfig::kCells) {
+        Coord gy = (Coord)(fruitCell / BoardConfig::kWidth);
+        int16_t y0 = (int16_t)(gy * BoardConfig::kCellSize);
+        if (y0 <= area.i16YMax && y0 + BoardConfig::kCellSize - 1 >= area.i16YMin) {
+            drawCell((Coord)(fruitCell % BoardConfig::kWidth), gy, CELL_FRUIT);
+        }
+    }
+    phaseEnd(PHASE_FRUIT);
+    tRectangle part;
+    for (uint8_t f = 0; f < HUD_FIELDS; ++f) {
+        if (intersect(&kHudBox[f], &area, &part)) drawHudField(f);
+    }
+    phaseEnd(PHASE_HUD);
+    if (debugMode) {
+        drawOverlayIn(&area);
+        if (intersect(&kPixelCountBox, &area, &part)) drawPixelCount();
+        phaseEnd(PHASE_OVERLAY);
     }
-#ifdef GrFlush
-    GrFlush(&gContext);
-#endif
 }
 
-void DrawKilScren() {
-    // Clear background
-    tRectangle full = {0, 0, 127, 127};
-    GrContextForegroundSet(&gContext, ClrBlack);
-    GrRectFill(&gContext, &full);
+// A cell that changed, in the incremental path: note the HUD fields it
+// wipes and whether the overlay has to go back over it
+static void redrawCell(uint32_t c, uint8_t* hudDirty, bool* underOverlay)
+{
+    Coord gx = (Coord)(c % BoardConfig::kWidth);
+    Coord gy = (Coord)(c / BoardConfig::kWidth);
+    drawCell(gx, gy, wantCells[c]);
+    if (gy < HUD_CELL_ROWS) *hudDirty |= hudFieldsOver(gx, gy);
+    if (debugMode && (gy + 1) * BoardConfig::kCellSize > DEBUG_TOP) *underOverlay = true;
+}
 
-    // Draw score
-    char scoreText[32];
+static void drawGameStrips(bool full)
+{
+    uint32_t strips = 0;
+    if (full) {
+        strips = stripsOver(0, 127);
+    } else {
+        for (uint32_t c = 0; c < BoardConfig::kCells; ++c) {
+            if (wantCells[c] == shownCells[c]) continue;
+            int16_t y0 = (int16_t)((c / BoardConfig::kWidth) * BoardConfig::kCellSize);
+            strips |= stripsOver(y0, (int16_t)(y0 + BoardConfig::kCellSize - 1));
+        }
+        for (uint8_t f = 0; f < HUD_FIELDS; ++f) {
+            if (hudValue(f) != shownHud[f]) strips |= stripsOver(kHudBox[f].i16YMin, kHudBox[f].i16YMax);
+        }
+    }
+    phaseEnd(PHASE_BODY);
+    if (debugMode) {
+        updateOverlay(&strips);
+        strips |= stripsOver(kPixelCountBox.i16YMin, kPixelCountBox.i16YMax);
+        phaseEnd(PHASE_OVERLAY);
+    }
 
-    GrContextFontSet(&gContext, &g_sFontCm30);
-    GrContextForegroundSet(&gContext, ClrRed);
-    snprintf(scoreText, sizeof(scoreText), "SNEK");
-    GrStringDrawCentered(&gContext, scoreText, -1, 64, 25, false);
-    snprintf(scoreText, sizeof(scoreText), "IS");
-    GrStringDrawCentered(&gContext, scoreText, -1, 64, 50, false);
-    snprintf(scoreText, sizeof(scoreText), "KIL");
-    GrStringDrawCentered(&gContext, scoreText, -1, 64, 75, false);
+    for (int16_t y = 0; y < 128; y += LCD_STRIP_ROWS) {
+        if (!(strips & stripsOver(y, y))) continue;
+        beginStrip(y);
+        composeGameStrip();
+        endStrip();
+        phaseEnd(PHASE_FLUSH);
+    }
+    for (uint8_t f = 0; f < HUD_FIELDS; ++f) shownHud[f] = hudValue(f);
+}
 
-    GrContextFontSet(&gContext, &g_sFontFixed6x8);
-    snprintf(scoreText, sizeof(scoreText), "High Score: %u", highScore);
-    GrContextForegroundSet(&gContext, ClrWhite);
-    GrStringDrawCentered(&gContext, scoreText, -1, 64, 100, false);
-    snprintf(scoreText, sizeof(scoreText), "Score: %u", score);
-    GrContextForegroundSet(&gContext, ClrWhite);
-    GrStringDrawCentered(&gContext, scoreText, -1, 64, 110, false);
+void DrawGame(const RenderFrame* f)
+{
+    frame = f;
+    view.restore(&f->game);
+
+    framePixels = 0;
+    buildWantCells();
+
+    bool full = !gIncrementalRender || !shownValid ||
+                debugMode != shownDebug || stripMode() != shownStrip ||
+                frame->seed != shownSeed || view.ticks() < shownTicks;
+    if (full) overlayValid = false;
+
+    memset(phaseUs, 0, sizeof(phaseUs));
+    phaseMark = micros();
+    if (debugMode && !stripMode()) {
+        updateOverlay(NULL);
+        phaseEnd(PHASE_OVERLAY);
+    }
+
+    if (stripMode()) {
+        drawGameStrips(full);
+    } else if (full) {
+        // Clear background
+        tRectangle screen = {0, 0, 127, 127};
+        fillRect(&screen, ClrBlack);
+        phaseEnd(PHASE_CLEAR);
+
+        // Draw snek, then fruit
+        for (uint32_t c = 0; c < BoardConfig::kCells; ++c) {
+            if (wantCells[c] != CELL_EMPTY && c != fruitCell) {
+                drawCell((Coord)(c % BoardConfig::kWidth), (Coord)(c / BoardConfig::kWidth), wantCells[c]);
+            }
+        }
+        phaseEnd(PHASE_BODY);
+        if (fruitCell < BoardConfig::kCells) {
+            drawCell((Coord)(fruitCell % BoardConfig::kWidth), (Coord)(fruitCell / BoardConfig::kWidth), CELL_FRUIT);
+        }
+        phaseEnd(PHASE_FRUIT);
+        drawHud((1u << HUD_FIELDS) - 1);
+        phaseEnd(PHASE_HUD);
+        if (debugMode) {
+            drawOverlayIn(&kScreen);
+            phaseEnd(PHASE_OVERLAY);
+        }
+    } else {
+        // Cells that changed, the fruit last. One in the HUD rows wipes
+        // the text of any field over it, so that field is repainted too;
+        // one under the overlay gets the overlay text back within the cell.
+        uint8_t hudDirty = 0;
+        bool underOverlay = false;
+        for (uint32_t c = 0; c < BoardConfig::kCells; ++c) {
+            if (wantCells[c] == shownCells[c] || c == fruitCell) continue;
+            redrawCell(c, &hudDirty, &underOverlay);
+        }
+        phaseEnd(PHASE_BODY);
+        if (fruitCell < BoardConfig::kCells && wantCells[fruitCell] != shownCells[fruitCell]) {
+            redrawCell(fruitCell, &hudDirty, &underOverlay);
+        }
+        phaseEnd(PHASE_FRUIT);
+        if (underOverlay) {
+            for (uint32_t c = 0; c < BoardConfig::kCells; ++c) {
+                if (wantCells[c] == shownCells[c]) continue;
+                Coord gy = (Coord)(c / BoardConfig::kWidth);
+                if ((gy + 1) * BoardConfig::kCellSize <= DEBUG_TOP) continue;
+                int16_t x0 = (int16_t)((c % BoardConfig::kWidth) * BoardConfig::kCellSize);
+                int16_t y0 = (int16_t)(gy * BoardConfig::kCellSize);
+                tRectangle cell = { x0, y0, (int16_t)(x0 + BoardConfig::kCellSize - 1),
+                                    (int16_t)(y0 + BoardConfig::kCellSize - 1) };
+                drawOverlayIn(&cell);
+            }
+            phaseEnd(PHASE_OVERLAY);
+        }
+
+        // Fields whose value changed
+        for (uint8_t f = 0; f < HUD_FIELDS; ++f) {
+            if (hudValue(f) != shownHud[f]) hudDirty |= (uint8_t)(1u << f);
+        }
+        drawHud(hudDirty);
+        phaseEnd(PHASE_HUD);
+    }
+    if (debugMode && !stripMode()) {
+        drawPixelCount();
+        phaseEnd(PHASE_OVERLAY);
+    }
 
+    memcpy(shownCells, wantCells, sizeof(shownCells));
+    shownValid    = true;
+    shownDebug    = debugMode;
+    shownStrip    = stripMode();
+    shownSeed     = frame->seed;
+    shownTicks    = view.ticks();
+    gPixelsLastFrame = framePixels;
 
 #ifdef GrFlush
     GrFlush(&gContext);
 #endif
+    phaseEnd(PHASE_FLUSH);
+    RenderProfile_Add(phaseUs);
 }
 
-void OverflowScreen() {
+// Centered line of text with a number on the end, fixed 6x8 font
+static void drawScoreLine(const char* label, uint32_t value, int32_t y)
+{
+    char text[24];
+    char* p = Digits_Str(text, label);
+    p = Digits_U32(p, value);
+    Digits_End(p);
+    GrStringDrawCentered(&gContext, text, -1, 64, y, false);
+}
+
+static void drawScores(void)
+{
+    GrContextFontSet(&gContext, &g_sFontFixed6x8);
+    GrContextForegroundSet(&gContext, ClrWhite);
+    drawScoreLine("High Score: ", frame->highScore, 100);
+    drawScoreLine("Score: ", frame->game.points, 110);
+}
+
+static void drawArtText(const char* const* lines, uint8_t count, int32_t y0, int32_t dy)
+{
+    for (uint8_t i = 0; i < count; ++i) {
+        GrStringDrawCentered(&gContext, lines[i], -1, 64, y0 + i * dy, false);
+    }
+}
+
+void DrawScreenArt(ScreenArt art) {
+    static const char* const kKilText[]      = { "SNEK", "IS", "KIL" };
+    static const char* const kWinText[]      = { "SNEK", "IS", "WIN" };
+    static const char* const kOverflowText[] = { "ERROR:", "STACK", "OVERFLOW" };
+
     // Clear background
     tRectangle full = {0, 0, 127, 127};
-    GrContextForegroundSet(&gContext, ClrBlue);
+    GrContextForegroundSet(&gContext, art == ART_OVERFLOW ? ClrBlue : ClrBlack);
     GrRectFill(&gContext, &full);
 
-    // Draw score
-    char scoreText[32];
+    switch (art) {
+    case ART_KIL:
+        GrContextFontSet(&gContext, &g_sFontCm30);
+        GrContextForegroundSet(&gContext, ClrRed);
+        drawArtText(kKilText, 3, 25, 25);
+        break;
+    case ART_WIN:
+        GrContextFontSet(&gContext, &g_sFontCm30);
+        GrContextForegroundSet(&gContext, ClrGreen);
+        drawArtText(kWinText, 3, 25, 25);
+        break;
+    default:
+        GrContextFontSet(&gContext, &g_sFontCm16);
+        GrContextForegroundSet(&gContext, ClrWhite);
+        drawArtText(kOverflowText, 3, 25, 15);
+        break;
+    }
+}
 
-    GrContextFontSet(&gContext, &g_sFontCm16);
-    GrContextForegroundSet(&gContext, ClrWhite);
-    snprintf(scoreText, sizeof(scoreText), "ERROR:");
-    GrStringDrawCentered(&gContext, scoreText, -1, 64, 25, false);
-    snprintf(scoreText, sizeof(scoreText), "STACK");
-    GrStringDrawCentered(&gContext, scoreText, -1, 64, 40, false);
-    snprintf(scoreText, sizeof(scoreText), "OVERFLOW");
-    GrStringDrawCentered(&gContext, scoreText, -1, 64, 55, false);
+// Fixed art from flash if it was generated, else drawn with grlib
+static void drawArt(ScreenArt art)
+{
+    if (!LCD_DrawRle(&kScreenArt[art])) DrawScreenArt(art);
+}
 
+// Draw a whole screen with compose(): straight into the screen buffer and
+// flushed, or once per strip in strip mode
+static void composeScreen(void (*compose)(void))
+{
+    if (!stripMode()) {
+        compose();
 #ifdef GrFlush
-    GrFlush(&gContext);
+        GrFlush(&gContext);
 #endif
+        return;
+    }
+    for (int16_t y = 0; y < 128; y += LCD_STRIP_ROWS) {
+        beginStrip(y);
+        compose();
+        endStrip();
+    }
+}
+
+static void composeKil(void)
+{
+    drawArt(ART_KIL);
+    drawScores();
+}
+
+static void composeWin(void)
+{
+    drawArt(ART_WIN);
+    drawScores();
+}
+
+static void composeOverflow(void)
+{
+    drawArt(ART_OVERFLOW);
+}
+
+void DrawKilScren(const RenderFrame* f) {
+    InvalidateGameScreen();   // game screen must repaint in full afterwards
+    frame = f;
+    composeScreen(composeKil);
+}
+
+void DrawWinScren(const RenderFrame* f) {
+    InvalidateGameScreen();   // game screen must repaint in full afterwards
+    frame = f;
+    composeScreen(composeWin);
+}
+
+// Called from the stack overflow hook, on the stack that overflowed: no
+// grlib text, just the run decoder (screen_art.cpp) and the panel writes.
+void OverflowScreen() {
+    composeScreen(composeOverflow);
 }
@@ -1,14 +1,21 @@
 #pragma once
 
-// Forward declaration for game state (defined in game.h).
-struct snekGameState;
+// Published game state (defined in game.h).
+struct RenderFrame;
 
 // Initialize LCD controller and the grlib drawing context.
 void LCD_Init(void);
 
-// Draw the full game frame: for now just background and snek.
-void DrawGame(const snekGameState* state);
+// Draw the game frame. Only cells, HUD fields and debug overlay lines that
+// changed since the last frame are repainted unless something forces a
+// full redraw (gIncrementalRender off, reset, rewind or debug toggle).
+void DrawGame(const RenderFrame* frame);
+
+// Make the next DrawGame() repaint the whole screen
+void InvalidateGameScreen(void);
 
 void OverflowScreen();
 // kil screen
-void DrawKilScren();
+void DrawKilScren(const RenderFrame* frame);
+// board full screen
+void DrawWinScren(const RenderFrame* frame);
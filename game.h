@@ -3,8 +3,12 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-// Direction for snek movement
-typedef enum { UP, DOWN, LEFT, RIGHT } Direction;
+#include "game_config.h"
+#include "game_engine.h"
+#include "input_log.h"
+#include "rewind.h"
+#include "autopilot.h"
+#include "triple_buffer.h"
 
 // High-level game state flags
 typedef struct snekGameState {
@@ -12,37 +16,89 @@ typedef struct snekGameState {
     bool isRunning;
     bool needsReset;
     bool snekIsKil;
+    bool snekHasWon;   // Board is full, nowhere left to put fruit
+    bool needsReplay;  // Play gInputLog back on the next snek tick
+    bool isReplaying;  // Directions come from gInputLog, joystick ignored
+    bool needsRewind;  // Step back REWIND_TICKS on the next snek tick
+    bool autopilot;    // gAutopilot steers; survives resets
+    uint8_t speedLevel; // Index into kSnekPeriodMs, from the score
 } snekGameState;
 
 extern snekGameState gameState;
 
-// Grid configuration (128x128 display, 8x8 cells)
-#define GRID_SIZE 16
-#define CELL_SIZE 8
-#define MAX_LEN   256  // Maximum snek length (16x16 grid)
+// Grid configuration comes from BoardConfig (game_config.h): 16x16 cells
+// of 8x8 pixels on the 128x128 display unless SNEK_GRID_SIZE says otherwise.
+typedef GameEngine<BoardConfig> SnekGame;
+typedef SnekGame::Coord    Coord;
+typedef SnekGame::Length   SnekLength;
+typedef SnekGame::Position Position;
 
-// Position on grid
-typedef struct { uint8_t x, y; } Position;
+// The game played on the board. All snek, fruit and score state lives in
+// here; vsnekTask steps it and the render task reads it.
+extern SnekGame gGame;
+extern SnekLength highScore;
 
-// snek representation
-extern Position snek[MAX_LEN];
-extern uint8_t snekLength;
-extern uint8_t score;
-extern uint8_t highScore;
+// Speed curve: the snek period drops one step every SPEED_POINTS_PER_LEVEL
+// points until the last level
+#define SPEED_LEVELS           8
+#define SPEED_POINTS_PER_LEVEL 5
+extern const uint16_t kSnekPeriodMs[SPEED_LEVELS];
 
+uint8_t SpeedLevel(SnekLength score);
 
-// fruit variables
-extern Position fruit;
-extern bool hasFruit;  // Track if fruit is currently placed
+// Ticks one rewind steps back: about 2 s at the 69 ms snek period
+#define REWIND_TICKS 29
 
+// Seed and direction changes of the current (or last finished) game.
+// Left alone during playback so the same game can be watched again.
+extern InputLog gInputLog;
+extern InputLogPlayer gReplay;
 
-// fruit method
-void SpawnFruit(void);
-bool HasEatenFruit(void);
+// Last few seconds of keyframes and per-tick deltas of the current game
+typedef RewindBuffer<BoardConfig> SnekRewind;
+extern SnekRewind gRewind;
 
-// Basic API
-void ResetGame(void);
-void movesnek(void);
+// Path-finding player, timed with micros() against AUTOPILOT_BUDGET_US
+typedef Autopilot<BoardConfig> SnekPilot;
+extern SnekPilot gAutopilot;
 
-bool IsHeadOnSnek(void);
-bool IsPositionOnSnek(uint8_t x, uint8_t y);
+// Everything the render task draws from. The snek task publishes one after
+// each change (PublishFrame) and the renderer takes the newest
+// (gFrames.acquire()), so a frame never mixes two ticks. The snek is the
+// 80-byte Snapshot rather than a copy of the engine.
+//
+// Every frame is whole rather than a delta (new head, vacated tail,
+// fruit, score) on purpose: the renderer skips frames whenever it falls
+// behind, and a delta it never saw would leave its copy wrong for good.
+// Deltas would need a queue that never drops, which is the blocking the
+// triple buffer is there to avoid. The whole-body encode in save() is
+// linear in the snek's length and bounded by the board; the renderer's
+// own cell diff already keeps what reaches the panel to the changed cells.
+typedef struct RenderFrame {
+    SnekGame::Snapshot game;
+    uint32_t   seed;
+    SnekLength highScore;
+    uint8_t    speedLevel;
+    bool       isReplaying;
+    bool       autopilot;
+    bool       snekIsKil;
+    bool       snekHasWon;
+} RenderFrame;
+
+extern TripleBuffer<RenderFrame> gFrames;
+
+// Snek task: publish gGame and the flags the HUD shows
+void PublishFrame(void);
+
+// Restart the game from seed and clear the task-level flags and chrono
+void ResetGame(uint32_t seed);
+
+// Restart the game recorded in gInputLog and play it back. Returns false
+// if the log is incomplete or the game it holds has not ended yet.
+bool StartReplay(void);
+
+// Take the game back REWIND_TICKS (or as far as the buffer reaches) and
+// pause it. The input log is cut back to match, so the rewound game can
+// still be replayed. Returns false if there is no history to go back to.
+// Not for use during playback, which must follow the log.
+bool RewindGame(void);
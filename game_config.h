@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+// Compile-time board geometry. Everything the engine needs to size its
+// arrays, loops and integer types is derived from the grid dimensions here,
+// so a smaller board gets narrower types and shorter loops at no runtime
+// cost.
+
+// Smallest unsigned integer type able to hold the value N
+template <uint32_t N, bool Fits8 = (N <= 0xFFu), bool Fits16 = (N <= 0xFFFFu)>
+struct UintFor               { typedef uint32_t type; };
+template <uint32_t N>
+struct UintFor<N, true, true>  { typedef uint8_t  type; };
+template <uint32_t N>
+struct UintFor<N, false, true> { typedef uint16_t type; };
+
+// Smallest power of two >= n (ring buffers index with a mask)
+constexpr uint32_t NextPow2(uint32_t n)
+{
+    uint32_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+template <uint8_t Width, uint8_t Height, uint8_t CellPx>
+struct GameConfig {
+    static constexpr uint8_t  kWidth    = Width;     // cells
+    static constexpr uint8_t  kHeight   = Height;    // cells
+    static constexpr uint8_t  kCellSize = CellPx;    // pixels per cell side
+    static constexpr uint32_t kCells    = (uint32_t)Width * Height;
+    static constexpr uint32_t kRingSize = NextPow2(kCells);  // snek ring capacity
+    static constexpr uint32_t kOccWords = (kCells + 31) / 32; // bitboard words
+
+    typedef typename UintFor<(Width > Height ? Width : Height) - 1>::type Coord;
+    typedef typename UintFor<kCells - 1>::type     CellIndex;  // y * kWidth + x
+    typedef typename UintFor<kRingSize - 1>::type  RingIndex;
+    typedef typename UintFor<kCells>::type         Length;     // snek length and score
+
+    // reset() lays the start snek from the center column leftwards, at
+    // x = Width/2 - 3 .. Width/2, which only stays on the board from 6 up
+    static_assert(Width >= 6 && Height >= 1, "board too small for the starting snek");
+    static_assert(Width * CellPx <= 128 && Height * CellPx <= 128,
+                  "board does not fit the 128x128 LCD");
+};
+
+// Board used by the game. Override with -DSNEK_GRID_SIZE=8/16/32/64.
+#ifndef SNEK_GRID_SIZE
+#define SNEK_GRID_SIZE 16
+#endif
+
+typedef GameConfig<SNEK_GRID_SIZE, SNEK_GRID_SIZE, 128 / SNEK_GRID_SIZE> BoardConfig;
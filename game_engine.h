@@ -0,0 +1,317 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game_config.h"
+#include "snek_rng.h"
+
+// Direction for snek movement
+typedef enum { UP, DOWN, LEFT, RIGHT } Direction;
+
+// Bit flags returned by GameEngine::step()
+enum GameEvent {
+    EVENT_NONE = 0,
+    EVENT_ATE  = 1u << 0,  // head landed on the fruit, snek grew
+    EVENT_DIED = 1u << 1,  // head landed on the body
+    EVENT_WON  = 1u << 2,  // board is full, nowhere left to put fruit
+};
+
+// Self-contained snek game: owns the body ring buffer, occupancy bitboard,
+// fruit, score and PRNG. No globals and no RTOS calls, so
+// any number of games can run side by side and the same code steps on the
+// board and on a host.
+template <class Cfg>
+class GameEngine {
+public:
+    typedef typename Cfg::Coord     Coord;
+    typedef typename Cfg::CellIndex CellIndex;
+    typedef typename Cfg::RingIndex RingIndex;
+    typedef typename Cfg::Length    Length;
+
+    // Position on grid
+    struct Position { Coord x, y; };
+
+    static const Length kStartLength = 4;
+
+    // Compact copy of everything step() depends on, for keyframes. The body
+    // is stored as the head cell plus one 2-bit Direction per link (segment
+    // i+1 lies that way from segment i), so a 16x16 board needs 80 bytes
+    // instead of the 1 KB+ of ring and bitboard it rebuilds.
+    struct Snapshot {
+        uint32_t  rngState;
+        uint32_t  tickCount;
+        Length    len;
+        Length    points;
+        CellIndex headCell;
+        CellIndex fruitCell;
+        uint8_t   heading;
+        uint8_t   flags;                          // SNAP_* below
+        uint8_t   links[(Cfg::kCells + 3) / 4];   // 4 links per byte
+    };
+    enum { SNAP_FRUIT = 1u << 0, SNAP_DEAD = 1u << 1, SNAP_WON = 1u << 2 };
+
+    explicit GameEngine(uint32_t seed = 1) { reset(seed); }
+
+    // Snek centered, heading right, first fruit placed. The whole game,
+    // fruit placement included, is a pure function of the seed and the
+    // directions passed to step().
+    void reset(uint32_t seed);
+    void reset(void) { reset(gameSeed); }
+
+    // Save/restore the full game state. Restoring and stepping continues
+    // exactly as the original game did, fruit placement included.
+    void save(Snapshot* snap) const;
+    void restore(const Snapshot* snap);
+
+    // Advance one tick heading in dir. Returns a mask of GameEvent flags.
+    // Once the snek has died or won, further steps do nothing.
+    uint8_t step(Direction dir);
+
+    // True if dir points straight back into the neck. step() takes any
+    // direction, so callers feeding it player input filter these out.
+    bool turnsBack(Direction dir) const { return ((uint8_t)dir ^ 1u) == heading; }
+
+    // Segment i of the snek (0 = head), wherever it sits in the ring
+    Position segment(Length i) const { return body[(head + i) & (Cfg::kRingSize - 1)]; }
+    Position headPos(void) const     { return body[head]; }
+    Length   length(void) const      { return len; }
+    Length   score(void) const       { return points; }
+    Position fruitPos(void) const    { return fruit; }
+    bool     hasFruit(void) const    { return fruitPlaced; }
+    bool     isDead(void) const      { return dead; }
+    bool     hasWon(void) const      { return won; }
+    uint8_t  direction(void) const   { return heading; }
+    uint32_t ticks(void) const       { return tickCount; }
+    uint32_t seed(void) const        { return gameSeed; }
+
+    static CellIndex cellOf(Coord x, Coord y) { return (CellIndex)(y * Cfg::kWidth + x); }
+
+    bool isOccupied(Coord x, Coord y) const
+    {
+        CellIndex cell = cellOf(x, y);
+        return (occupancy[cell >> 5] >> (cell & 31)) & 1u;
+    }
+
+private:
+    void occupy(Position p);
+    void vacate(Position p);
+    bool spawnFruit(void);
+
+    // Body ring buffer. The old tail stays just past len after a move, so
+    // growing only needs len++.
+    Position  body[Cfg::kRingSize];
+    RingIndex head;
+    Length    len;
+
+    // One bit per cell (cell = y * kWidth + x) while a segment sits on it.
+    // While the snek is alive it covers exactly len cells.
+    uint32_t occupancy[Cfg::kOccWords];
+
+    Position fruit;
+    bool     fruitPlaced;
+    Length   points;
+    uint8_t  heading;
+    bool     dead;
+    bool     won;
+    uint32_t tickCount;
+    uint32_t gameSeed;
+    SnekRng  rng;
+};
+
+template <class Cfg>
+void GameEngine<Cfg>::reset(uint32_t seed)
+{
+    gameSeed = seed;
+    rng.seed(seed);
+
+    for (uint32_t w = 0; w < Cfg::kOccWords; ++w) {
+        occupancy[w] = 0;
+    }
+
+    // Head at the center, body to the left
+    Coord cx = Cfg::kWidth / 2;
+    Coord cy = Cfg::kHeight / 2;
+    head = 0;
+    len  = kStartLength;
+    for (uint8_t i = 0; i < kStartLength; ++i) {
+        body[i].x = (Coord)(cx - i);
+        body[i].y = cy;
+        occupy(body[i]);
+    }
+
+    heading   = RIGHT;
+    points    = 0;
+    dead      = false;
+    won       = false;
+    tickCount = 0;
+    spawnFruit();
+}
+
+template <class Cfg>
+inline void GameEngine<Cfg>::occupy(Position p)
+{
+    CellIndex cell = cellOf(p.x, p.y);
+    occupancy[cell >> 5] |= 1u << (cell & 31);
+}
+
+template <class Cfg>
+inline void GameEngine<Cfg>::vacate(Position p)
+{
+    CellIndex cell = cellOf(p.x, p.y);
+    occupancy[cell >> 5] &= ~(1u << (cell & 31));
+}
+
+// Set bits in a word (no popcount instruction on the M4)
+static inline uint32_t PopCount32(uint32_t v)
+{
+    v = v - ((v >> 1) & 0x55555555u);
+    v = (v & 0x33333333u) + ((v >> 2) & 0x33333333u);
+    return (((v + (v >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+}
+
+// Place fruit on the k-th empty cell in cell order, k drawn uniformly. The
+// pick depends only on the bitboard, not on the order moves happened in,
+// so a restored snapshot places the same fruit as the original game. Cost
+// is bounded by one popcount per bitboard word plus one word scan.
+template <class Cfg>
+bool GameEngine<Cfg>::spawnFruit(void)
+{
+    uint32_t freeCount = Cfg::kCells - len;
+    if (freeCount == 0) {
+        // Snek covers every cell: nothing left to eat
+        fruitPlaced = false;
+        return false;
+    }
+
+    uint32_t k = rng.below(freeCount);
+    for (uint32_t w = 0; w < Cfg::kOccWords; ++w) {
+        uint32_t clear = ~occupancy[w];
+        if (w == Cfg::kOccWords - 1 && (Cfg::kCells & 31)) {
+            clear &= (1u << (Cfg::kCells & 31)) - 1;   // bits past the board
+        }
+        uint32_t n = PopCount32(clear);
+        if (k < n) {
+            while (k--) clear &= clear - 1;            // drop the k lowest
+            uint32_t bit = 0;
+            while (!(clear & (1u << bit))) bit++;
+            uint32_t cell = w * 32 + bit;
+
+            fruit.x = (Coord)(cell % Cfg::kWidth);
+            fruit.y = (Coord)(cell / Cfg::kWidth);
+            fruitPlaced = true;
+            return true;
+        }
+        k -= n;
+    }
+    fruitPlaced = false;   // not reached while len matches the bitboard
+    return false;
+}
+
+template <class Cfg>
+void GameEngine<Cfg>::save(Snapshot* snap) const
+{
+    snap->rngState  = rng.raw();
+    snap->tickCount = tickCount;
+    snap->len       = len;
+    snap->points    = points;
+    snap->headCell  = cellOf(body[head].x, body[head].y);
+    snap->fruitCell = cellOf(fruit.x, fruit.y);
+    snap->heading   = heading;
+    snap->flags     = (uint8_t)((fruitPlaced ? SNAP_FRUIT : 0) | (dead ? SNAP_DEAD : 0) |
+                                (won ? SNAP_WON : 0));
+
+    for (uint32_t b = 0; b < sizeof(snap->links); ++b) {
+        snap->links[b] = 0;
+    }
+    for (Length i = 0; i + 1 < len; ++i) {
+        Position a = segment(i);
+        Position n = segment((Length)(i + 1));
+        uint8_t d;
+        if      (n.x == a.x) d = (n.y == (a.y + 1) % Cfg::kHeight) ? DOWN : UP;
+        else                 d = (n.x == (a.x + 1) % Cfg::kWidth)  ? RIGHT : LEFT;
+        snap->links[i >> 2] |= (uint8_t)(d << ((i & 3) * 2));
+    }
+}
+
+template <class Cfg>
+void GameEngine<Cfg>::restore(const Snapshot* snap)
+{
+    rng.setRaw(snap->rngState);
+    tickCount   = snap->tickCount;
+    len         = snap->len;
+    points      = snap->points;
+    heading     = snap->heading;
+    fruitPlaced = (snap->flags & SNAP_FRUIT) != 0;
+    dead        = (snap->flags & SNAP_DEAD) != 0;
+    won         = (snap->flags & SNAP_WON) != 0;
+    fruit.x     = (Coord)(snap->fruitCell % Cfg::kWidth);
+    fruit.y     = (Coord)(snap->fruitCell / Cfg::kWidth);
+
+    for (uint32_t w = 0; w < Cfg::kOccWords; ++w) {
+        occupancy[w] = 0;
+    }
+
+    // Walk the links from the head, wrapping like step() does
+    Position p;
+    p.x = (Coord)(snap->headCell % Cfg::kWidth);
+    p.y = (Coord)(snap->headCell / Cfg::kWidth);
+    head = 0;
+    for (Length i = 0; i < len; ++i) {
+        body[i] = p;
+        occupy(p);
+        switch ((snap->links[i >> 2] >> ((i & 3) * 2)) & 3u) {
+            case UP:    p.y = (p.y == 0) ? (Coord)(Cfg::kHeight - 1) : (Coord)(p.y - 1); break;
+            case DOWN:  p.y = (p.y == Cfg::kHeight - 1) ? (Coord)0 : (Coord)(p.y + 1); break;
+            case LEFT:  p.x = (p.x == 0) ? (Coord)(Cfg::kWidth - 1) : (Coord)(p.x - 1); break;
+            case RIGHT: p.x = (p.x == Cfg::kWidth - 1) ? (Coord)0 : (Coord)(p.x + 1); break;
+        }
+    }
+}
+
+template <class Cfg>
+uint8_t GameEngine<Cfg>::step(Direction dir)
+{
+    if (dead || won) return EVENT_NONE;
+
+    heading = (uint8_t)dir;
+    tickCount++;
+
+    // Push a new head slot in front of the old one
+    Position p = body[head];
+    head = (RingIndex)((head - 1) & (Cfg::kRingSize - 1));
+
+    // The tail leaves its cell this tick (growing puts it back), so the head
+    // may legally move into the cell the tail just vacated.
+    vacate(segment(len));
+
+    // Move the head with wrap-around. Coord is unsigned, so check the edge
+    // before decrementing instead of letting 0 - 1 underflow.
+    switch (dir) {
+        case UP:    p.y = (p.y == 0) ? (Coord)(Cfg::kHeight - 1) : (Coord)(p.y - 1); break;
+        case DOWN:  p.y = (p.y == Cfg::kHeight - 1) ? (Coord)0 : (Coord)(p.y + 1); break;
+        case LEFT:  p.x = (p.x == 0) ? (Coord)(Cfg::kWidth - 1) : (Coord)(p.x - 1); break;
+        case RIGHT: p.x = (p.x == Cfg::kWidth - 1) ? (Coord)0 : (Coord)(p.x + 1); break;
+    }
+
+    body[head] = p;
+    if (isOccupied(p.x, p.y)) {
+        dead = true;
+        return EVENT_DIED;
+    }
+    occupy(p);
+
+    if (!fruitPlaced || p.x != fruit.x || p.y != fruit.y) {
+        return EVENT_NONE;
+    }
+
+    // Ate: keep the tail dropped above and place the next fruit
+    len++;
+    occupy(segment(len - 1));
+    points++;
+    if (!spawnFruit()) {
+        won = true;
+        return EVENT_ATE | EVENT_WON;
+    }
+    return EVENT_ATE;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "game_engine.h"
+
+// A Hamiltonian cycle over the board, for host tools that need a snek of a
+// given length that can move forever without dying. The cycle runs along
+// columns 1..W-1 row by row, left to right on even rows and back on odd
+// ones, then up column 0 to the start. A snek lies on consecutive cycle
+// cells, head last; following the cycle never hits the body, and the head
+// reaches every cell (so every fruit) within kCells ticks.
+//
+// The snek reset() places (head at the center of an even row, heading
+// right, body to the left) already lies on the cycle for the 8..64 boards.
+
+template <class Cfg>
+struct BoardCycle {
+    typedef typename Cfg::Coord Coord;
+
+    static_assert(Cfg::kHeight % 2 == 0 && Cfg::kWidth >= 2, "cycle needs an even height");
+
+    static const uint32_t kRowCells = Cfg::kWidth - 1u;
+
+    // Cell k of the cycle, 0 <= k < kCells
+    static void cell(uint32_t k, Coord* x, Coord* y)
+    {
+        uint32_t rows = Cfg::kHeight * kRowCells;
+        if (k >= rows) {
+            *x = 0;
+            *y = (Coord)(Cfg::kHeight - 1u - (k - rows));
+            return;
+        }
+        uint32_t row = k / kRowCells;
+        uint32_t j   = k % kRowCells;
+        *y = (Coord)row;
+        *x = (Coord)((row & 1u) ? Cfg::kWidth - 1u - j : 1u + j);
+    }
+
+    static uint32_t indexOf(Coord x, Coord y)
+    {
+        if (x == 0) return Cfg::kHeight * kRowCells + (Cfg::kHeight - 1u - y);
+        uint32_t j = (y & 1u) ? Cfg::kWidth - 1u - x : x - 1u;
+        return y * kRowCells + j;
+    }
+
+    // Step from one cell to a neighbouring one (no wrap-around on the cycle)
+    static Direction toward(Coord x, Coord y, Coord nx, Coord ny)
+    {
+        if (ny == y) return (nx > x) ? RIGHT : LEFT;
+        return (ny > y) ? DOWN : UP;
+    }
+
+    // Direction the head takes from cell (x, y) to stay on the cycle
+    static Direction next(Coord x, Coord y)
+    {
+        Coord nx, ny;
+        cell((indexOf(x, y) + 1u) % Cfg::kCells, &nx, &ny);
+        return toward(x, y, nx, ny);
+    }
+
+    // Put g's snek on the cycle: len segments with the head on cell headK,
+    // heading along the cycle. With fruitAhead the fruit sits on the next
+    // cycle cell (len < kCells - 1), else there is none, so stepping never
+    // eats and the length stays put.
+    template <class Engine>
+    static void place(Engine* g, typename Engine::Length len, uint32_t headK, bool fruitAhead)
+    {
+        typename Engine::Snapshot snap;
+        g->save(&snap);
+
+        Coord hx, hy, nx, ny;
+        cell(headK % Cfg::kCells, &hx, &hy);
+        cell((headK + 1u) % Cfg::kCells, &nx, &ny);
+        snap.len       = len;
+        snap.points    = (typename Engine::Length)(len - Engine::kStartLength);
+        snap.tickCount = 0;
+        snap.headCell  = Engine::cellOf(hx, hy);
+        snap.heading   = (uint8_t)toward(hx, hy, nx, ny);
+        snap.flags     = 0;
+        snap.fruitCell = Engine::cellOf(nx, ny);
+        if (fruitAhead) snap.flags |= Engine::SNAP_FRUIT;
+
+        for (uint32_t b = 0; b < sizeof(snap.links); ++b) snap.links[b] = 0;
+        Coord ax = hx, ay = hy;
+        for (uint32_t i = 0; i + 1u < len; ++i) {
+            Coord bx, by;
+            cell((headK + Cfg::kCells - i - 1u) % Cfg::kCells, &bx, &by);
+            snap.links[i >> 2] |= (uint8_t)(toward(ax, ay, bx, by) << ((i & 3u) * 2u));
+            ax = bx;
+            ay = by;
+        }
+        g->restore(&snap);
+    }
+};
@@ -0,0 +1,159 @@
+// Generates screen_art.cpp: the fixed part of the kil, win and overflow
+// screens, drawn by DrawScreenArt() with the real grlib fonts into the
+// screen (mem_display.cpp stands in for the driver), then stored as palette
+// runs (RleImage, see lcd_dirty.h). Each image is decoded again with
+// LCD_DrawRle and compared with what grlib drew before it is written.
+//
+// Build (from the project root) like snek_render, same grlib objects:
+//   g++ -O2 -std=c++14 -I. -Ihost -I$TIVAWARE -I$LCD_DRIVER
+//       -I$FREERTOS/include -I$FREERTOS/portable/ThirdParty/GCC/Posix
+//       host/gen_screens.cpp host/mem_display.cpp display.cpp lcd_dirty.cpp
+//       tiles.cpp game.cpp screen_art.cpp render_profile.cpp *.o -o gen_screens
+// (one line). It links the current screen_art.cpp only to satisfy
+// display.cpp; the art is always redrawn with grlib.
+//
+// Usage:
+//   gen_screens [out.cpp]        (default screen_art.cpp)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+#include "grlib/grlib.h"
+}
+
+#include "app_objects.h"
+#include "game.h"
+#include "display.h"
+#include "lcd_dirty.h"
+#include "screen_art.h"
+#include "mem_display.h"
+
+// What main.cpp provides on the board
+tContext gContext;
+volatile uint32_t gAvgPeriodUs = 0;
+volatile int32_t  gLastJitterSnapshot = 0;
+volatile uint32_t gAvgExecUs = 0;
+volatile uint32_t gMaxExecUs = 0;
+volatile uint32_t gCurrentFPS = 0;
+volatile uint32_t gStatsSeq = 0;
+volatile uint32_t gameTimeMs = 0;
+LevelTiming gLevelTiming[SPEED_LEVELS];
+bool debugMode = false;
+uint8_t gNumTasks = 6;
+uint8_t snek_cpu, render_cpu, input_cpu, gCpuUtil;
+TaskCpuInfo gTaskCpuInfo[MAX_TASKS];
+StackInfo stackInput, stackSnake, stackRender, stackMonitor;
+
+uint32_t micros(void) { return 0; }
+
+void FormatGameTime(char* buffer, size_t bufSize, uint32_t timeMs)
+{
+    snprintf(buffer, bufSize, "00:00:00");
+}
+
+static const char* kArtNames[ART_COUNT] = { "ART_KIL", "ART_WIN", "ART_OVERFLOW" };
+static const char* kDataNames[ART_COUNT] = { "kKilData", "kWinData", "kOverflowData" };
+
+#define PIXELS (MEM_LCD_WIDTH * MEM_LCD_HEIGHT)
+
+struct Encoded {
+    uint16_t palette[4];
+    uint8_t colors = 0;
+    std::vector<uint8_t> data;
+};
+
+static void putRun(Encoded* e, uint8_t index, uint32_t n)
+{
+    if (n < 64) {
+        e->data.push_back((uint8_t)((index << 6) | n));
+    } else {
+        e->data.push_back((uint8_t)(index << 6));
+        e->data.push_back((uint8_t)n);
+        e->data.push_back((uint8_t)(n >> 8));
+    }
+}
+
+static bool encode(const uint16_t* px, Encoded* e)
+{
+    uint32_t i = 0;
+    while (i < PIXELS) {
+        uint16_t c = px[i];
+        uint8_t index = 0;
+        while (index < e->colors && e->palette[index] != c) index++;
+        if (index == e->colors) {
+            if (e->colors == 4) return false;
+            e->palette[e->colors++] = c;
+        }
+        uint32_t n = 1;
+        while (i + n < PIXELS && px[i + n] == c) n++;
+        putRun(e, index, n);
+        i += n;
+    }
+    while (e->colors < 4) e->palette[e->colors++] = 0;
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    const char* outPath = argc > 1 ? argv[1] : "screen_art.cpp";
+
+    LCD_Init();
+
+    static uint16_t drawn[PIXELS];
+    static uint16_t decoded[PIXELS];
+    Encoded art[ART_COUNT];
+    for (uint8_t a = 0; a < ART_COUNT; ++a) {
+        DrawScreenArt((ScreenArt)a);
+        LCD_ReadScreen(drawn);
+        if (!encode(drawn, &art[a])) {
+            fprintf(stderr, "%s: more than 4 colors\n", kArtNames[a]);
+            return 1;
+        }
+        if (art[a].data.size() > 0xFFFF) {
+            fprintf(stderr, "%s: %zu bytes, too long\n", kArtNames[a], art[a].data.size());
+            return 1;
+        }
+
+        RleImage check = { { art[a].palette[0], art[a].palette[1], art[a].palette[2], art[a].palette[3] },
+                           (uint16_t)art[a].data.size(), art[a].data.data() };
+        DrawScreenArt(a == ART_KIL ? ART_WIN : ART_KIL);    // something else underneath
+        LCD_DrawRle(&check);
+        LCD_ReadScreen(decoded);
+        if (memcmp(drawn, decoded, sizeof(drawn)) != 0) {
+            fprintf(stderr, "%s: decoded image differs\n", kArtNames[a]);
+            return 1;
+        }
+        printf("%-12s %5zu bytes (%u px raw: %u bytes)\n", kArtNames[a], art[a].data.size(),
+               PIXELS, PIXELS * 2);
+    }
+
+    FILE* f = fopen(outPath, "w");
+    if (!f) {
+        fprintf(stderr, "cannot write %s\n", outPath);
+        return 1;
+    }
+    fprintf(f, "// Generated by host/gen_screens; do not edit. Rerun it after changing\n"
+               "// DrawScreenArt() or the fonts it uses.\n\n"
+               "#include <stddef.h>\n#include <stdint.h>\n\n#include \"screen_art.h\"\n");
+    for (uint8_t a = 0; a < ART_COUNT; ++a) {
+        fprintf(f, "\nstatic const uint8_t %s[] = {", kDataNames[a]);
+        for (size_t i = 0; i < art[a].data.size(); ++i) {
+            fprintf(f, "%s0x%02X,", i % 12 ? " " : "\n    ", art[a].data[i]);
+        }
+        fprintf(f, "\n};\n");
+    }
+    fprintf(f, "\nconst RleImage kScreenArt[ART_COUNT] = {\n");
+    for (uint8_t a = 0; a < ART_COUNT; ++a) {
+        const Encoded& e = art[a];
+        fprintf(f, "    { { 0x%04X, 0x%04X, 0x%04X, 0x%04X }, sizeof(%s), %s },   // %s\n",
+                e.palette[0], e.palette[1], e.palette[2], e.palette[3],
+                kDataNames[a], kDataNames[a], kArtNames[a]);
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+    return 0;
+}
@@ -0,0 +1,167 @@
+// Emulated Crystalfontz128x128 panel for host builds (see mem_display.h).
+// Only the HAL entry points lcd_dirty.cpp calls are provided.
+
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+#include "driverlib/sysctl.h"
+#include "HAL_EK_TM4C1294XL_Crystalfontz128x128_ST7735.h"
+}
+
+#include "mem_display.h"
+
+#define ST7735_SLPOUT 0x11
+#define ST7735_CASET  0x2A
+#define ST7735_RASET  0x2B
+#define ST7735_RAMWR  0x2C
+
+// Where the glass sits in controller RAM, upright (see lcd_dirty.cpp)
+#define MEM_LCD_COL0 2
+#define MEM_LCD_ROW0 3
+
+MemDisplayStats gMemStats;
+uint16_t gMemPanel[MEM_LCD_WIDTH * MEM_LCD_HEIGHT];
+
+void MemDisplay_ResetStats(void)
+{
+    memset(&gMemStats, 0, sizeof(gMemStats));
+}
+
+//
+// Emulated ST7735: a column/row window in controller coordinates and a
+// RAMWR stream, high byte first. Pixels off the glass are dropped.
+//
+static struct {
+    uint8_t  cmd;
+    uint8_t  argCount;
+    uint8_t  args[4];
+    int32_t  xs, xe, ys, ye;    // window
+    int32_t  x, y;              // next pixel
+    bool     haveHigh;
+    uint8_t  high;
+} panel;
+
+extern "C" void HAL_LCD_writeCommand(uint8_t ui8Command)
+{
+    gMemStats.busBytes++;
+    panel.cmd      = ui8Command;
+    panel.argCount = 0;
+    panel.haveHigh = false;
+    switch (ui8Command) {
+    case ST7735_SLPOUT:
+        // Real panel RAM comes up undefined; start black so runs compare
+        memset(gMemPanel, 0, sizeof(gMemPanel));
+        break;
+    case ST7735_CASET:
+        gMemStats.windows++;
+        break;
+    case ST7735_RAMWR:
+        panel.x = panel.xs;
+        panel.y = panel.ys;
+        break;
+    default:
+        break;
+    }
+}
+
+extern "C" void HAL_LCD_writeData(uint8_t ui8Data)
+{
+    gMemStats.busBytes++;
+    switch (panel.cmd) {
+    case ST7735_CASET:
+    case ST7735_RASET:
+        if (panel.argCount < 4) panel.args[panel.argCount++] = ui8Data;
+        if (panel.argCount == 4) {
+            int32_t lo = (panel.args[0] << 8) | panel.args[1];
+            int32_t hi = (panel.args[2] << 8) | panel.args[3];
+            if (panel.cmd == ST7735_CASET) { panel.xs = lo; panel.xe = hi; }
+            else                           { panel.ys = lo; panel.ye = hi; }
+        }
+        break;
+    case ST7735_RAMWR: {
+        if (!panel.haveHigh) {
+            panel.high     = ui8Data;
+            panel.haveHigh = true;
+            break;
+        }
+        panel.haveHigh = false;
+        int32_t x = panel.x - MEM_LCD_COL0;
+        int32_t y = panel.y - MEM_LCD_ROW0;
+        if (panel.y <= panel.ye && x >= 0 && x < MEM_LCD_WIDTH && y >= 0 && y < MEM_LCD_HEIGHT) {
+            gMemPanel[y * MEM_LCD_WIDTH + x] = (uint16_t)((panel.high << 8) | ui8Data);
+        }
+        if (++panel.x > panel.xe) {
+            panel.x = panel.xs;
+            panel.y++;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+extern "C" void HAL_LCD_PortInit(void)
+{
+    memset(&panel, 0, sizeof(panel));
+}
+
+extern "C" void HAL_LCD_SpiInit(void) {}
+
+extern "C" void SysCtlDelay(uint32_t ui32Count)
+{
+    (void)ui32Count;
+}
+
+uint32_t MemDisplay_PanelDiff(const uint16_t* screen)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < MEM_LCD_WIDTH * MEM_LCD_HEIGHT; ++i) {
+        if (gMemPanel[i] != screen[i]) n++;
+    }
+    return n;
+}
+
+bool MemDisplay_WritePpm(const char* path, const uint16_t* pixels)
+{
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", MEM_LCD_WIDTH, MEM_LCD_HEIGHT);
+    for (uint32_t i = 0; i < MEM_LCD_WIDTH * MEM_LCD_HEIGHT; ++i) {
+        uint16_t c = pixels[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31)
+        };
+        fwrite(rgb, 1, 3, f);
+    }
+    return fclose(f) == 0;
+}
+
+int32_t MemDisplay_ComparePpm(const char* path, const uint16_t* pixels)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+    int w = 0, h = 0, maxval = 0;
+    if (fscanf(f, "P6 %d %d %d", &w, &h, &maxval) != 3 || w != MEM_LCD_WIDTH ||
+        h != MEM_LCD_HEIGHT || maxval != 255 || fgetc(f) == EOF) {
+        fclose(f);
+        return -1;
+    }
+    int32_t diff = 0;
+    for (uint32_t i = 0; i < MEM_LCD_WIDTH * MEM_LCD_HEIGHT; ++i) {
+        uint8_t rgb[3];
+        if (fread(rgb, 1, 3, f) != 3) {
+            fclose(f);
+            return -1;
+        }
+        uint16_t c = (uint16_t)(((rgb[0] * 31 + 127) / 255) << 11 |
+                                ((rgb[1] * 63 + 127) / 255) << 5 |
+                                ((rgb[2] * 31 + 127) / 255));
+        if (c != pixels[i]) diff++;
+    }
+    fclose(f);
+    return diff;
+}
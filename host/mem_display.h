@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Host stand-in for the Crystalfontz128x128 panel, so display.cpp and
+// lcd_dirty.cpp build and run unchanged on Linux. It defines the driver
+// HAL's HAL_LCD_* entry points as an emulated ST7735 that takes the
+// column/row window (glass offset included) and RAMWR stream into its own
+// panel memory, so a dirty-rect flush can be checked against the buffer
+// it was sent from, plus driverlib's SysCtlDelay as a no-op. Every bus
+// byte is counted so render cost can be measured per frame.
+
+#define MEM_LCD_WIDTH  128
+#define MEM_LCD_HEIGHT 128
+
+typedef struct {
+    uint32_t windows;       // CASET commands
+    uint32_t busBytes;      // command and data bytes sent to the panel
+} MemDisplayStats;
+
+extern MemDisplayStats gMemStats;
+
+// What the emulated panel shows, RGB565
+extern uint16_t gMemPanel[MEM_LCD_WIDTH * MEM_LCD_HEIGHT];
+
+void MemDisplay_ResetStats(void);
+
+// Pixels where the panel differs from an RGB565 screen (LCD_ReadScreen)
+uint32_t MemDisplay_PanelDiff(const uint16_t* screen);
+
+// Write an RGB565 screen (gMemPanel, say) as a binary PPM
+bool MemDisplay_WritePpm(const char* path, const uint16_t* pixels);
+
+// Compare an RGB565 screen against a PPM written by MemDisplay_WritePpm.
+// Returns the number of differing pixels, or -1 if the file is unreadable
+// or not a 128x128 PPM.
+int32_t MemDisplay_ComparePpm(const char* path, const uint16_t* pixels);
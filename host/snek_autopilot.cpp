@@ -0,0 +1,124 @@
+// Host-side benchmark for the autopilot. Plays games with Autopilot
+// choosing every move and reports decision time per tick bucketed by snek
+// length (the search grows with the board, the body changes what is open),
+// how often the budget ran out, which stage made the decisions, and the
+// scores reached.
+//
+// Build (from the project root):
+//   g++ -O2 -std=c++14 -I. host/snek_autopilot.cpp -o snek_autopilot
+// Add -DSNEK_GRID_SIZE=8/32/64 for another board size.
+//
+// Usage:
+//   snek_autopilot [--games N] [--seed S] [--budget-us B] [--max-ticks M]
+//
+// Host times are far below the board's; they show how the cost scales with
+// length, and whether the budget logic behaves when B is made tiny.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#include "game_config.h"
+#include "game_engine.h"
+#include "autopilot.h"
+
+typedef GameEngine<BoardConfig> Engine;
+typedef Autopilot<BoardConfig> Pilot;
+
+static const uint32_t kBuckets = 8;   // length buckets across the board
+
+static uint32_t HostMicros(void)
+{
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t HostNanos(void)
+{
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+struct Bucket {
+    uint64_t decisions = 0;
+    uint64_t totalNs   = 0;
+    uint64_t maxNs     = 0;
+};
+
+int main(int argc, char** argv)
+{
+    uint32_t games    = 200;
+    uint32_t seed     = 1;
+    uint32_t budgetUs = AUTOPILOT_BUDGET_US;
+    uint32_t maxTicks = 200000;
+    for (int i = 1; i < argc; ++i) {
+        const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if      (!strcmp(argv[i], "--games") && v)     games = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "--seed") && v)      seed = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "--budget-us") && v) budgetUs = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "--max-ticks") && v) maxTicks = (uint32_t)strtoul(v, NULL, 0);
+        else {
+            fprintf(stderr, "usage: %s [--games N] [--seed S] [--budget-us B] [--max-ticks M]\n",
+                    argv[0]);
+            return 2;
+        }
+        ++i;
+    }
+
+    static Pilot pilot(HostMicros, budgetUs);
+    static Engine game;
+    Bucket buckets[kBuckets];
+    uint64_t modes[3] = { 0, 0, 0 };
+    uint64_t scoreSum = 0, wins = 0, deaths = 0, capped = 0;
+    Engine::Length bestScore = 0;
+
+    for (uint32_t n = 0; n < games; ++n) {
+        game.reset(seed + n);
+        uint8_t events = EVENT_NONE;
+        while (!(events & (EVENT_DIED | EVENT_WON)) && game.ticks() < maxTicks) {
+            uint32_t b = (uint32_t)(game.length() - 1) * kBuckets / BoardConfig::kCells;
+            uint64_t t0 = HostNanos();
+            Direction d = pilot.decide(game);
+            uint64_t ns = HostNanos() - t0;
+
+            buckets[b].decisions++;
+            buckets[b].totalNs += ns;
+            if (ns > buckets[b].maxNs) buckets[b].maxNs = ns;
+            modes[pilot.stats().mode]++;
+
+            events = game.step(d);
+        }
+        scoreSum += game.score();
+        if (game.score() > bestScore) bestScore = game.score();
+        if (events & EVENT_WON) wins++;
+        else if (events & EVENT_DIED) deaths++;
+        else capped++;
+    }
+
+    const AutopilotStats& s = pilot.stats();
+    printf("board %ux%u  games %u  budget %u us\n",
+           BoardConfig::kWidth, BoardConfig::kHeight, games, budgetUs);
+    printf("score mean %.1f  max %u  won %llu  died %llu  capped %llu\n",
+           games ? (double)scoreSum / games : 0.0, bestScore,
+           (unsigned long long)wins, (unsigned long long)deaths, (unsigned long long)capped);
+    printf("decisions %u  over budget %u  path %.1f%%  tail %.1f%%  safe %.1f%%\n",
+           s.decisions, s.overBudget,
+           100.0 * modes[AUTO_PATH] / (s.decisions ? s.decisions : 1),
+           100.0 * modes[AUTO_TAIL] / (s.decisions ? s.decisions : 1),
+           100.0 * modes[AUTO_SAFE] / (s.decisions ? s.decisions : 1));
+
+    printf("\n  length       decisions    avg us    max us\n");
+    for (uint32_t b = 0; b < kBuckets; ++b) {
+        if (!buckets[b].decisions) continue;
+        uint32_t lo = b * BoardConfig::kCells / kBuckets + 1;
+        uint32_t hi = (b + 1) * BoardConfig::kCells / kBuckets;
+        printf("%5u-%-5u %12llu %9.2f %9.2f\n", lo, hi,
+               (unsigned long long)buckets[b].decisions,
+               buckets[b].totalNs / 1000.0 / buckets[b].decisions, buckets[b].maxNs / 1000.0);
+    }
+    return 0;
+}
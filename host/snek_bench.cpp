@@ -0,0 +1,212 @@
+// Host-side benchmark of the per-tick engine cost by snek length. A snek
+// of each length is laid on a Hamiltonian cycle (host/board_cycle.h) and
+// stepped along it with no fruit, so it never eats, dies or changes
+// length, and the time per GameEngine::step is reported. The "shift"
+// column is the old movesnek for comparison: every segment copied one
+// slot down a plain array each tick.
+//
+// A second table compares the occupancy bitboard with the segment scans
+// it replaced, at the lengths 4, 64, 200 and 255: one collision check (bit
+// test against scanning every segment), and placing a fruit with that
+// many cells taken (the engine's eat tick, including spawnFruit, against
+// the old rejection loop that re-scanned the body for every random pick).
+//
+// Build (from the project root):
+//   g++ -O2 -std=c++14 -I. -Ihost host/snek_bench.cpp -o snek_bench
+// Add -DSNEK_GRID_SIZE=8/32/64 for another board size. The lengths run
+// up to kCells - 1 (255 on 16x16, where 256 would fill the board); use a
+// 32x32 build to step a snek of 256.
+//
+// Usage:
+//   snek_bench [--ticks N]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "game_config.h"
+#include "game_engine.h"
+#include "board_cycle.h"
+#include "snek_rng.h"
+
+typedef GameEngine<BoardConfig> Engine;
+typedef BoardCycle<BoardConfig> Cycle;
+
+typedef std::chrono::steady_clock Clock;
+
+static double NsSince(Clock::time_point t0)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+}
+
+static const uint32_t kLengths[] = { 4, 8, 16, 32, 64, 128, 200, 255, 256 };
+static const uint32_t kOccLengths[] = { 4, 64, 200, 255 };
+
+// Direction out of each cell along the cycle, looked up while timing
+static Direction gNext[BoardConfig::kCells];
+
+static double StepNs(uint32_t len, uint32_t ticks)
+{
+    static Engine game;
+    uint32_t headK = Cycle::indexOf(BoardConfig::kWidth / 2, BoardConfig::kHeight / 2);
+    Cycle::place(&game, (Engine::Length)len, headK, false);
+
+    Clock::time_point t0 = Clock::now();
+    for (uint32_t i = 0; i < ticks; ++i) {
+        Engine::Position h = game.headPos();
+        game.step(gNext[Engine::cellOf(h.x, h.y)]);
+    }
+    double ns = NsSince(t0) / ticks;
+    if (game.isDead() || game.length() != len) {
+        fprintf(stderr, "len %u: snek left the cycle\n", len);
+        exit(1);
+    }
+    return ns;
+}
+
+// The array movesnek this engine replaced: shift the body, write the head
+static double ShiftNs(uint32_t len, uint32_t ticks)
+{
+    static Engine::Position body[BoardConfig::kCells];
+    uint32_t headK = Cycle::indexOf(BoardConfig::kWidth / 2, BoardConfig::kHeight / 2);
+    for (uint32_t i = 0; i < len; ++i) {
+        Cycle::cell((headK + BoardConfig::kCells - i) % BoardConfig::kCells, &body[i].x, &body[i].y);
+    }
+
+    Clock::time_point t0 = Clock::now();
+    for (uint32_t i = 0; i < ticks; ++i) {
+        Engine::Position h = body[0];
+        for (uint32_t s = len - 1; s > 0; --s) body[s] = body[s - 1];
+        switch (gNext[Engine::cellOf(h.x, h.y)]) {
+            case UP:    h.y--; break;
+            case DOWN:  h.y++; break;
+            case LEFT:  h.x--; break;
+            case RIGHT: h.x++; break;
+        }
+        body[0] = h;
+        __asm__ __volatile__("" : : "r"(body) : "memory");
+    }
+    return NsSince(t0) / ticks;
+}
+
+// Old IsPositionOnSnek: compare against every segment
+static bool OnSnekScan(const Engine& g, Engine::Coord x, Engine::Coord y)
+{
+    for (Engine::Length i = 0; i < g.length(); ++i) {
+        Engine::Position p = g.segment(i);
+        if (p.x == x && p.y == y) return true;
+    }
+    return false;
+}
+
+// One collision check against each cell in turn, bitboard or scan
+static double CheckNs(uint32_t len, uint32_t reps, bool scan)
+{
+    static Engine game;
+    Cycle::place(&game, (Engine::Length)len, 0, false);
+    uint32_t hits = 0;
+
+    Clock::time_point t0 = Clock::now();
+    for (uint32_t i = 0; i < reps; ++i) {
+        uint32_t c = i % BoardConfig::kCells;
+        Engine::Coord x = (Engine::Coord)(c % BoardConfig::kWidth);
+        Engine::Coord y = (Engine::Coord)(c / BoardConfig::kWidth);
+        hits += scan ? OnSnekScan(game, x, y) : game.isOccupied(x, y);
+        __asm__ __volatile__("" : "+r"(hits));
+    }
+    return NsSince(t0) / reps;
+}
+
+// Eat tick that leaves len cells taken: restore a snek of len - 1 with the
+// fruit ahead and step onto it, less the cost of the restore alone
+static double EatNs(uint32_t len, uint32_t reps)
+{
+    static Engine game;
+    Engine::Snapshot snap;
+    Cycle::place(&game, (Engine::Length)(len - 1), 0, true);
+    game.save(&snap);
+    Engine::Position h = game.headPos();
+    Direction d = gNext[Engine::cellOf(h.x, h.y)];
+
+    Clock::time_point t0 = Clock::now();
+    for (uint32_t i = 0; i < reps; ++i) {
+        snap.rngState = i + 1;              // a different pick each time
+        game.restore(&snap);
+        __asm__ __volatile__("" : : "r"(&game) : "memory");
+    }
+    double restoreNs = NsSince(t0) / reps;
+
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < reps; ++i) {
+        snap.rngState = i + 1;
+        game.restore(&snap);
+        if (!(game.step(d) & EVENT_ATE)) {
+            fprintf(stderr, "len %u: eat tick did not eat\n", len);
+            exit(1);
+        }
+        __asm__ __volatile__("" : : "r"(&game) : "memory");
+    }
+    double ns = NsSince(t0) / reps - restoreNs;
+    return (ns > 0.0) ? ns : 0.0;
+}
+
+// Old SpawnFruit: random cells until one is off the snek, each by a scan
+static double OldSpawnNs(uint32_t len, uint32_t reps)
+{
+    static Engine game;
+    Cycle::place(&game, (Engine::Length)len, 0, false);
+    SnekRng rng(1);
+    uint32_t sum = 0;
+
+    Clock::time_point t0 = Clock::now();
+    for (uint32_t i = 0; i < reps; ++i) {
+        uint32_t c;
+        do {
+            c = rng.below(BoardConfig::kCells);
+        } while (OnSnekScan(game, (Engine::Coord)(c % BoardConfig::kWidth),
+                            (Engine::Coord)(c / BoardConfig::kWidth)));
+        sum += c;
+        __asm__ __volatile__("" : "+r"(sum));
+    }
+    return NsSince(t0) / reps;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t ticks = 4000000;
+    for (int i = 1; i < argc; ++i) {
+        const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!strcmp(argv[i], "--ticks") && v) { ticks = (uint32_t)strtoul(v, NULL, 0); ++i; }
+        else {
+            fprintf(stderr, "usage: %s [--ticks N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    for (uint32_t c = 0; c < BoardConfig::kCells; ++c) {
+        Engine::Coord x = (Engine::Coord)(c % BoardConfig::kWidth);
+        Engine::Coord y = (Engine::Coord)(c / BoardConfig::kWidth);
+        gNext[c] = Cycle::next(x, y);
+    }
+
+    printf("board %ux%u, %u ticks per length\n", BoardConfig::kWidth, BoardConfig::kHeight, ticks);
+    printf("  len    step ns   shift ns\n");
+    for (uint32_t n = 0; n < sizeof(kLengths) / sizeof(kLengths[0]); ++n) {
+        uint32_t len = kLengths[n];
+        if (len >= BoardConfig::kCells) continue;
+        printf("%5u %10.2f %10.2f\n", len, StepNs(len, ticks), ShiftNs(len, ticks));
+    }
+
+    printf("\n  len   bit test       scan    eat tick  old spawn   (ns)\n");
+    for (uint32_t n = 0; n < sizeof(kOccLengths) / sizeof(kOccLengths[0]); ++n) {
+        uint32_t len = kOccLengths[n];
+        if (len >= BoardConfig::kCells) continue;
+        uint32_t reps = ticks / 8;
+        printf("%5u %10.2f %10.2f %11.2f %10.2f\n", len, CheckNs(len, ticks, false),
+               CheckNs(len, reps, true), EatNs(len, reps), OldSpawnNs(len, reps / 16));
+    }
+    return 0;
+}
@@ -0,0 +1,170 @@
+// Host-side test of one board configuration (game_config.h). Build it once
+// per SNEK_GRID_SIZE; each build checks that the derived integer types are
+// the tightest ones for its board, plays random games checking the engine
+// invariants every tick (occupancy matches the body, fruit on a free cell,
+// snapshot round trip), and drives one game along a Hamiltonian cycle
+// (host/board_cycle.h) until the snek fills the board, so score and length
+// reach kCells without overflowing their types.
+//
+// Build and run the whole matrix (from the project root, one line):
+//   for n in 8 16 32 64; do g++ -O2 -std=c++14 -I. -Ihost -DSNEK_GRID_SIZE=$n
+//       host/snek_config_test.cpp -o snek_config_test_$n &&
+//       ./snek_config_test_$n || break; done
+//
+// Usage:
+//   snek_config_test [--games N] [--seed S]
+// Exits 1 on the first failure.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "game_config.h"
+#include "game_engine.h"
+#include "board_cycle.h"
+#include "snek_rng.h"
+
+typedef GameEngine<BoardConfig> Engine;
+typedef BoardCycle<BoardConfig> Cycle;
+
+static const Direction kOpposite[4] = { DOWN, UP, RIGHT, LEFT };
+
+static void Fail(const char* what, uint32_t seed, uint32_t tick)
+{
+    fprintf(stderr, "FAIL %ux%u seed %u tick %u: %s\n",
+            BoardConfig::kWidth, BoardConfig::kHeight, seed, tick, what);
+    exit(1);
+}
+
+// Bytes the tightest unsigned type holding max needs
+static size_t TightBytes(uint32_t max)
+{
+    return (max <= 0xFFu) ? 1 : (max <= 0xFFFFu) ? 2 : 4;
+}
+
+static void CheckTypes(void)
+{
+    if (sizeof(Engine::Coord) != TightBytes(BoardConfig::kWidth - 1u) ||
+        sizeof(Engine::CellIndex) != TightBytes(BoardConfig::kCells - 1u) ||
+        sizeof(Engine::RingIndex) != TightBytes(BoardConfig::kRingSize - 1u) ||
+        sizeof(Engine::Length) != TightBytes(BoardConfig::kCells)) {
+        Fail("integer types are not the tightest for the board", 0, 0);
+    }
+    if (BoardConfig::kRingSize < BoardConfig::kCells ||
+        (BoardConfig::kRingSize & (BoardConfig::kRingSize - 1u)) != 0 ||
+        BoardConfig::kOccWords * 32u < BoardConfig::kCells) {
+        Fail("ring or bitboard too small", 0, 0);
+    }
+    printf("types    Coord %zu, CellIndex %zu, RingIndex %zu, Length %zu bytes; engine %zu bytes\n",
+           sizeof(Engine::Coord), sizeof(Engine::CellIndex), sizeof(Engine::RingIndex),
+           sizeof(Engine::Length), sizeof(Engine));
+}
+
+// Occupancy covers exactly the body, and the fruit is on a free cell
+static void CheckInvariants(const Engine& g, uint32_t seed)
+{
+    uint32_t taken = 0;
+    for (uint32_t c = 0; c < BoardConfig::kCells; ++c) {
+        taken += g.isOccupied((Engine::Coord)(c % BoardConfig::kWidth),
+                              (Engine::Coord)(c / BoardConfig::kWidth));
+    }
+    if (taken != g.length()) Fail("occupied cells differ from the length", seed, g.ticks());
+    for (Engine::Length i = 0; i < g.length(); ++i) {
+        Engine::Position p = g.segment(i);
+        if (p.x >= BoardConfig::kWidth || p.y >= BoardConfig::kHeight) {
+            Fail("segment off the board", seed, g.ticks());
+        }
+        if (!g.isOccupied(p.x, p.y)) Fail("segment not in the bitboard", seed, g.ticks());
+    }
+    if (g.hasFruit() && g.isOccupied(g.fruitPos().x, g.fruitPos().y)) {
+        Fail("fruit on the snek", seed, g.ticks());
+    }
+    if (g.score() != g.length() - Engine::kStartLength) Fail("score and length disagree", seed, g.ticks());
+}
+
+static void CheckRoundTrip(const Engine& g, uint32_t seed)
+{
+    Engine::Snapshot snap;
+    g.save(&snap);
+    Engine copy(seed + 1);
+    copy.restore(&snap);
+    if (copy.length() != g.length() || copy.score() != g.score() || copy.ticks() != g.ticks() ||
+        copy.isDead() != g.isDead() || copy.hasWon() != g.hasWon()) {
+        Fail("snapshot round trip differs", seed, g.ticks());
+    }
+    for (Engine::Length i = 0; i < g.length(); ++i) {
+        if (copy.segment(i).x != g.segment(i).x || copy.segment(i).y != g.segment(i).y) {
+            Fail("snapshot round trip moved a segment", seed, g.ticks());
+        }
+    }
+}
+
+static void RandomGames(uint32_t games, uint32_t seed)
+{
+    Engine game;
+    SnekRng policy(seed ^ 0x5EED5EEDu);
+    uint64_t ticks = 0;
+    uint32_t deaths = 0;
+    for (uint32_t n = 0; n < games; ++n) {
+        game.reset(seed + n);
+        CheckInvariants(game, seed + n);
+        uint8_t events = EVENT_NONE;
+        while (!(events & (EVENT_DIED | EVENT_WON)) && game.ticks() < 20000) {
+            Direction d = (Direction)policy.below(4);
+            if (d == kOpposite[game.direction()]) d = (Direction)game.direction();
+            events = game.step(d);
+            if (!(events & EVENT_DIED)) CheckInvariants(game, seed + n);
+        }
+        if (events & EVENT_DIED) deaths++;
+        CheckRoundTrip(game, seed + n);
+        ticks += game.ticks();
+    }
+    printf("random   %u games, %llu ticks, %u deaths, invariants hold every tick\n",
+           games, (unsigned long long)ticks, deaths);
+}
+
+// Follow the cycle from the reset position until the board is full
+static void FullBoard(uint32_t seed)
+{
+    Engine game(seed);
+    const uint64_t limit = (uint64_t)BoardConfig::kCells * BoardConfig::kCells;
+    uint8_t events = EVENT_NONE;
+    while (!(events & (EVENT_DIED | EVENT_WON))) {
+        if (game.ticks() > limit) Fail("full-board game did not finish", seed, game.ticks());
+        Engine::Position h = game.headPos();
+        events = game.step(Cycle::next(h.x, h.y));
+        if (events & EVENT_ATE) CheckInvariants(game, seed);
+    }
+    if (!(events & EVENT_WON)) Fail("snek died on the cycle", seed, game.ticks());
+    if (game.length() != BoardConfig::kCells || game.score() != BoardConfig::kCells - Engine::kStartLength) {
+        Fail("won without filling the board", seed, game.ticks());
+    }
+    if (game.step(RIGHT) != EVENT_NONE) Fail("stepped after winning", seed, game.ticks());
+    CheckRoundTrip(game, seed);
+    printf("full     won at length %u, score %u after %u ticks\n",
+           (unsigned)game.length(), (unsigned)game.score(), game.ticks());
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t games = 200;
+    uint32_t seed  = 1;
+    for (int i = 1; i < argc; ++i) {
+        const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if      (!strcmp(argv[i], "--games") && v) { games = (uint32_t)strtoul(v, NULL, 0); ++i; }
+        else if (!strcmp(argv[i], "--seed") && v)  { seed = (uint32_t)strtoul(v, NULL, 0); ++i; }
+        else {
+            fprintf(stderr, "usage: %s [--games N] [--seed S]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("board %ux%u, %u px cells\n", BoardConfig::kWidth, BoardConfig::kHeight,
+           BoardConfig::kCellSize);
+    CheckTypes();
+    RandomGames(games, seed);
+    FullBoard(seed);
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Host-side model of input-to-flush latency on the board, for the render
+// task polled every RENDER_PERIOD_MS (before) and woken by the snek task's
+// notification (now). Only the scheduling is modelled: the tasks run at
+// the board's periods and priorities, and a stick change at a random
+// instant is followed through them.
+//  - The input task samples every INPUT_TICK_MS (20 ms) and queues the
+//    change. It has the highest priority, so a snek tick on the same
+//    RTOS tick already sees it.
+//  - The snek task takes it on its next tick (kSnekPeriodMs) and steps.
+//  - Polled: the render task looked at the mailbox every RENDER_PERIOD_MS.
+//    It outranks the snek task, so a poll on the step's own RTOS tick
+//    ran before the step and missed it.
+//  - Notified: the render task starts as soon as the step is published.
+// Each task keeps its own vTaskDelay(Until) phase, which depends on how
+// long it ran before its loop (the render task sits in LCD_Init for over
+// 120 ms) and shifts with every speed change, so the input and render
+// phases are drawn at random, in whole RTOS ticks, per stick change.
+// The waits are exact for that model. The frame itself (draw plus SPI
+// flush) is added as F, which is what gFrameLatencyUs reads on the board
+// for the notified path.
+//
+// Build (from the project root):
+//   g++ -O2 -std=c++14 -I. host/snek_latency.cpp -o snek_latency
+//
+// Usage:
+//   snek_latency [--events N] [--frame-us F] [--seed S]
+//
+// Reports, per speed level and overall, the average and maximum of
+// step-to-flush (what gFrameLatencyAvgUs/MaxUs measure) and of
+// input-to-flush (gInputLatencyAvgUs/MaxUs, from the input task's queue
+// send) for both paths.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "snek_rng.h"
+
+static const uint32_t kInputTickUs = 20000;         // INPUT_TICK_MS in main.cpp
+static const uint16_t kSnekPeriodMs[] = { 69, 62, 56, 50, 45, 41, 37, 33 };   // game.cpp
+static const uint32_t kLevels = sizeof(kSnekPeriodMs) / sizeof(kSnekPeriodMs[0]);
+
+// The polled render period the notification replaced
+static uint32_t RenderPeriodMs(uint32_t snekMs)
+{
+    return (snekMs * 11u + 10u) / 20u;
+}
+
+struct Latency {
+    uint64_t sum = 0;
+    uint32_t max = 0;
+    uint32_t n   = 0;
+
+    void add(uint32_t us)
+    {
+        sum += us;
+        if (us > max) max = us;
+        n++;
+    }
+
+    void merge(const Latency& o)
+    {
+        sum += o.sum;
+        if (o.max > max) max = o.max;
+        n += o.n;
+    }
+
+    double avgMs(void) const { return n ? (double)sum / n / 1000.0 : 0.0; }
+    double maxMs(void) const { return max / 1000.0; }
+};
+
+struct LevelStats {
+    Latency stepPolled, stepNotified, inputPolled, inputNotified;
+
+    void merge(const LevelStats& o)
+    {
+        stepPolled.merge(o.stepPolled);
+        stepNotified.merge(o.stepNotified);
+        inputPolled.merge(o.inputPolled);
+        inputNotified.merge(o.inputNotified);
+    }
+};
+
+// First phase + k * period at or after t (t >= phase)
+static uint64_t NextTick(uint64_t t, uint64_t period, uint64_t phase)
+{
+    return phase + (t - phase + period - 1) / period * period;
+}
+
+static void Usage(const char* argv0)
+{
+    fprintf(stderr, "usage: %s [--events N] [--frame-us F] [--seed S]\n", argv0);
+    exit(2);
+}
+
+static void PrintRow(const char* name, const LevelStats& s)
+{
+    printf("%-6s %9.1f %9.1f %9.1f %9.1f   %9.1f %9.1f %9.1f %9.1f\n", name,
+           s.stepPolled.avgMs(), s.stepPolled.maxMs(), s.stepNotified.avgMs(), s.stepNotified.maxMs(),
+           s.inputPolled.avgMs(), s.inputPolled.maxMs(), s.inputNotified.avgMs(), s.inputNotified.maxMs());
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t events  = 1000000;
+    uint32_t frameUs = 0;
+    uint32_t seed    = 1;
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!v) Usage(argv[0]);
+        if      (!strcmp(a, "--events"))   events  = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(a, "--frame-us")) frameUs = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(a, "--seed"))     seed    = (uint32_t)strtoul(v, NULL, 0);
+        else Usage(argv[0]);
+        ++i;
+    }
+    if (events == 0) Usage(argv[0]);
+
+    SnekRng rng(seed);
+    LevelStats all;
+    printf("frame F = %u us (draw + flush, added to every figure)\n", frameUs);
+    printf("ms      step-to-flush                            input-to-flush\n");
+    printf("level    poll avg  poll max  ntfy avg  ntfy max    poll avg  poll max  ntfy avg  ntfy max\n");
+    for (uint32_t level = 0; level < kLevels; ++level) {
+        // Snek ticks at multiples of its period; the stick changes at a
+        // random instant a while in
+        uint64_t snekUs   = kSnekPeriodMs[level] * 1000ull;
+        uint32_t renderMs = RenderPeriodMs(kSnekPeriodMs[level]);
+        uint64_t renderUs = renderMs * 1000ull;
+        LevelStats s;
+        for (uint32_t e = 0; e < events; ++e) {
+            uint64_t inputPhase  = rng.below(kInputTickUs / 1000u) * 1000ull;
+            uint64_t renderPhase = rng.below(renderMs) * 1000ull;
+            uint64_t t    = 1000000ull + rng.below(1000000u);
+            uint64_t seen = NextTick(t, kInputTickUs, inputPhase);
+            uint64_t step = NextTick(seen, snekUs, 0);
+            uint64_t poll = NextTick(step + 1, renderUs, renderPhase);   // strictly after the step
+
+            uint32_t polled   = (uint32_t)(poll - step) + frameUs;
+            uint32_t notified = frameUs;
+            s.stepPolled.add(polled);
+            s.stepNotified.add(notified);
+            s.inputPolled.add((uint32_t)(step - seen) + polled);
+            s.inputNotified.add((uint32_t)(step - seen) + notified);
+        }
+        char name[8];
+        snprintf(name, sizeof(name), "%u", level);
+        PrintRow(name, s);
+
+        all.merge(s);
+    }
+    PrintRow("all", all);
+    return 0;
+}
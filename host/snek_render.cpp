@@ -0,0 +1,401 @@
+// Host-side render benchmark and golden-image check. Builds display.cpp,
+// lcd_dirty.cpp, tiles.cpp and game.cpp as they are for the board, with
+// the LCD driver's HAL replaced by the emulated panel in mem_display.cpp.
+// Plays autopilot games, publishes and draws a frame per tick the way the
+// snek and render tasks would, and reports the publish cost and, per
+// frame, draw time, pixels written, grlib fill and text calls, cell tiles
+// copied straight into the frame buffer, and the bytes that went over the
+// (emulated) SPI bus. After every flush the emulated panel is compared
+// with the frame buffer, so a flush that misses a changed pixel shows up
+// as a panel mismatch.
+//
+// Draws run on a thread of their own whose stack is painted first, like
+// the render task's, and the report ends with the RAM the display path
+// needs: screen or strip buffer plus the deepest stack any draw reached
+// beyond what an empty thread uses (host stack frames, so compare the two
+// modes rather than read it as the board's figure).
+//
+// Build (from the project root). TivaWare supplies grlib, FreeRTOS only
+// headers (the POSIX port's portmacro.h), and LCD_DRIVER is the course's
+// Crystalfontz128x128 driver directory, for the HAL header:
+//   G=$TIVAWARE/grlib
+//   gcc -O2 -c -I$TIVAWARE $G/context.c $G/rectangle.c $G/line.c $G/string.c
+//       $G/charmap.c $G/fonts/fontfixed6x8.c $G/fonts/fontcm12.c
+//       $G/fonts/fontcm16.c $G/fonts/fontcm30.c
+//   g++ -O2 -std=c++14 -I. -Ihost -I$TIVAWARE -I$LCD_DRIVER
+//       -I$FREERTOS/include -I$FREERTOS/portable/ThirdParty/GCC/Posix
+//       host/snek_render.cpp host/mem_display.cpp display.cpp lcd_dirty.cpp
+//       tiles.cpp game.cpp screen_art.cpp render_profile.cpp *.o -pthread
+//       -o snek_render
+// (each command on one line). Add -DLCD_STRIP_ONLY to build it the way a
+// strip-only board image is, with no screen buffer; --strips is then
+// implied and --no-dirty has no effect.
+//
+// Usage:
+//   snek_render [--games N] [--seed S] [--max-ticks M] [--debug]
+//               [--full] [--no-dirty] [--strips]
+//               [--tick T (--ppm out.ppm | --golden ref.ppm)]
+//               [--screens DIR]
+//
+// --full draws every frame from scratch, --no-dirty flushes the whole
+// screen, --strips composes frames a strip at a time with no screen
+// buffer (gStripRender; the panel check is skipped since there is no
+// buffer to compare with, use --golden against a buffered run instead),
+// --debug turns the task-manager overlay on. --ppm writes the panel
+// as it stands after frame T of the first game; --golden compares it with
+// a saved one and exits 1 on any difference. --screens writes the kil, win
+// and overflow screens as DIR/kil.ppm, DIR/win.ppm and DIR/overflow.ppm.
+//
+// Only PPM is written; convert with any image tool if PNG is wanted.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <pthread.h>
+
+#include <chrono>
+#include <string>
+
+extern "C" {
+#include "grlib/grlib.h"
+}
+
+#include "app_objects.h"
+#include "game.h"
+#include "display.h"
+#include "lcd_dirty.h"
+#include "render_profile.h"
+#include "mem_display.h"
+
+// What main.cpp provides on the board
+tContext gContext;
+volatile uint32_t gAvgPeriodUs = 0;
+volatile int32_t  gLastJitterSnapshot = 0;
+volatile uint32_t gAvgExecUs = 0;
+volatile uint32_t gMaxExecUs = 0;
+volatile uint32_t gCurrentFPS = 0;
+volatile uint32_t gStatsSeq = 0;
+volatile uint32_t gameTimeMs = 0;
+LevelTiming gLevelTiming[SPEED_LEVELS];
+bool debugMode = false;
+uint8_t gNumTasks = 6;
+uint8_t snek_cpu, render_cpu, input_cpu, gCpuUtil;
+TaskCpuInfo gTaskCpuInfo[MAX_TASKS];
+StackInfo stackInput, stackSnake, stackRender, stackMonitor;
+
+extern bool gIncrementalRender;
+#ifdef LCD_STRIP_ONLY
+static const bool gStripRender = true;      // the only mode in this build
+#else
+extern bool gStripRender;
+#endif
+
+uint32_t micros(void)
+{
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t HostNanos(void)
+{
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Same format as main.cpp
+void FormatGameTime(char* buffer, size_t bufSize, uint32_t timeMs)
+{
+    uint32_t totalCs      = timeMs / 10;
+    uint32_t minutes      = totalCs / 6000;
+    uint32_t remainingCs  = totalCs % 6000;
+    uint32_t seconds      = remainingCs / 100;
+    uint32_t centiseconds = remainingCs % 100;
+    snprintf(buffer, bufSize, "%02u:%02u:%02u", minutes, seconds, centiseconds);
+}
+
+// Plausible task-manager numbers, so the overlay draws its usual text
+static void FakeMonitorStats(uint32_t n)
+{
+    static const char* kNames[6] = { "Monitor", "IDLE", "Tmr Svc", "Input", "Render", "Snek" };
+    for (uint8_t i = 0; i < 6; ++i) {
+        strncpy(gTaskCpuInfo[i].name, kNames[i], sizeof(gTaskCpuInfo[i].name) - 1);
+        gTaskCpuInfo[i].cpuPercent = (uint8_t)((i == 1) ? 60 + n % 20 : (n + i * 7) % 15);
+    }
+    gCpuUtil = (uint8_t)(100 - gTaskCpuInfo[1].cpuPercent);
+    stackSnake.used  = 40 + n % 8;
+    stackRender.used = 180 + n % 16;
+    stackInput.used  = 60;
+    for (uint8_t l = 0; l < SPEED_LEVELS; ++l) {
+        gLevelTiming[l].lastJitterUs = (int32_t)(n % 500);
+        gLevelTiming[l].maxJitterUs  = 900;
+    }
+    gCurrentFPS = 26;
+    RenderProfile_Publish();
+    gStatsSeq++;
+}
+
+// Display counters before a draw; FrameStats adds what the draw changed
+struct LcdCounts {
+    uint32_t pixels, fills, runs, tiles;
+
+    static LcdCounts now(void)
+    {
+        return { gLcdPixelWrites, gLcdFills, gLcdTextRuns, gTileBlits };
+    }
+};
+
+struct FrameStats {
+    uint64_t frames = 0;
+    uint64_t ns = 0, maxNs = 0;
+    uint64_t pixelWrites = 0, fillCalls = 0, textCalls = 0, tiles = 0, busBytes = 0, windows = 0;
+    uint64_t panelBad = 0;
+
+    void add(uint64_t t, const LcdCounts& before)
+    {
+        uint32_t tileBlits = gTileBlits - before.tiles;
+        frames++;
+        ns += t;
+        if (t > maxNs) maxNs = t;
+        pixelWrites += gLcdPixelWrites - before.pixels;
+        fillCalls   += gLcdFills - before.fills;
+        textCalls   += gLcdTextRuns - before.runs;
+        tiles       += tileBlits;
+        pixelWrites += tileBlits * TILE_SIZE * TILE_SIZE;
+        busBytes    += gMemStats.busBytes;
+        windows     += gMemStats.windows;
+#ifndef LCD_STRIP_ONLY
+        static uint16_t screen[MEM_LCD_WIDTH * MEM_LCD_HEIGHT];
+        if (gStripRender) return;
+        LCD_ReadScreen(screen);
+        if (MemDisplay_PanelDiff(screen)) panelBad++;
+#endif
+    }
+
+    void print(const char* what) const
+    {
+        double n = frames ? (double)frames : 1.0;
+        printf("%-9s %7llu frames  %8.1f us avg %8.1f us max  px %7.0f  fills %5.1f  "
+               "text runs %6.1f  tiles %4.1f  windows %4.1f  bus %7.0f B\n",
+               what, (unsigned long long)frames, ns / n / 1000.0, maxNs / 1000.0,
+               pixelWrites / n, fillCalls / n, textCalls / n, tiles / n, windows / n, busBytes / n);
+    }
+};
+
+// The render task's stack: painted once, then every draw runs on it
+#define RENDER_STACK_BYTES (256 * 1024)
+#define STACK_PAINT 0xA5
+alignas(64) static uint8_t renderStack[RENDER_STACK_BYTES];
+
+struct DrawJob {
+    void (*draw)(const RenderFrame*);
+    const RenderFrame* frame;
+    uint64_t ns;
+};
+
+static void* RunDrawJob(void* arg)
+{
+    DrawJob* job = (DrawJob*)arg;
+    uint64_t t0 = HostNanos();
+    job->draw(job->frame);
+    job->ns = HostNanos() - t0;
+    return NULL;
+}
+
+// Draw on the render stack; returns the draw time
+static uint64_t DrawOnRenderStack(void (*draw)(const RenderFrame*), const RenderFrame* frame)
+{
+    DrawJob job = { draw, frame, 0 };
+    pthread_attr_t attr;
+    pthread_t thread;
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, renderStack, sizeof(renderStack));
+    if (pthread_create(&thread, &attr, RunDrawJob, &job) != 0) {
+        RunDrawJob(&job);
+    } else {
+        pthread_join(thread, NULL);
+    }
+    pthread_attr_destroy(&attr);
+    return job.ns;
+}
+
+// Deepest the render stack has been used (it grows down), thread start-up
+// included
+static uint32_t RenderStackPeak(void)
+{
+    uint32_t i = 0;
+    while (i < RENDER_STACK_BYTES && renderStack[i] == STACK_PAINT) i++;
+    return RENDER_STACK_BYTES - i;
+}
+
+static void DrawOverflow(const RenderFrame*)
+{
+    OverflowScreen();
+}
+
+static void DrawNothing(const RenderFrame*)
+{
+}
+
+// gRenderProfile for the window since the last publish
+static void PrintProfile(void)
+{
+    static const char* kPhaseNames[RENDER_PHASES] = { "clear", "body", "fruit", "hud", "overlay", "flush" };
+    RenderProfile_Publish();
+    printf("DrawGame phases over the last %u frames, us (histogram: frames per bucket up to", gRenderProfile.frames);
+    for (uint8_t b = 0; b < PROFILE_BUCKETS - 1; ++b) printf(" %u", kProfileBucketUs[b]);
+    printf(", then more)\n");
+    for (uint8_t p = 0; p < RENDER_PHASES; ++p) {
+        const PhaseStats* s = &gRenderProfile.phase[p];
+        printf("  %-8s min %6u avg %6u max %6u  |", kPhaseNames[p], s->minUs, s->avgUs, s->maxUs);
+        for (uint8_t b = 0; b < PROFILE_BUCKETS; ++b) printf(" %u", s->hist[b]);
+        printf("\n");
+    }
+}
+
+static bool WriteScreens(const std::string& dir)
+{
+    bool ok = true;
+    PublishFrame();
+    DrawKilScren(gFrames.acquire());
+    ok &= MemDisplay_WritePpm((dir + "/kil.ppm").c_str(), gMemPanel);
+    DrawWinScren(gFrames.acquire());
+    ok &= MemDisplay_WritePpm((dir + "/win.ppm").c_str(), gMemPanel);
+    OverflowScreen();
+    ok &= MemDisplay_WritePpm((dir + "/overflow.ppm").c_str(), gMemPanel);
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t games    = 20;
+    uint32_t seed     = 1;
+    uint32_t maxTicks = 20000;
+    uint32_t shotTick = 0;
+    const char* ppmPath    = NULL;
+    const char* goldenPath = NULL;
+    const char* screensDir = NULL;
+    for (int i = 1; i < argc; ++i) {
+        const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if      (!strcmp(argv[i], "--debug"))    { debugMode = true; continue; }
+        else if (!strcmp(argv[i], "--full"))     { gIncrementalRender = false; continue; }
+        else if (!strcmp(argv[i], "--no-dirty")) { gDirtyFlush = false; continue; }
+#ifdef LCD_STRIP_ONLY
+        else if (!strcmp(argv[i], "--strips"))   continue;
+#else
+        else if (!strcmp(argv[i], "--strips"))   { gStripRender = true; continue; }
+#endif
+        else if (!strcmp(argv[i], "--games") && v)     games = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "--seed") && v)      seed = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "--max-ticks") && v) maxTicks = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "--tick") && v)      shotTick = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "--ppm") && v)       ppmPath = v;
+        else if (!strcmp(argv[i], "--golden") && v)    goldenPath = v;
+        else if (!strcmp(argv[i], "--screens") && v)   screensDir = v;
+        else {
+            fprintf(stderr, "usage: %s [--games N] [--seed S] [--max-ticks M] [--debug] [--full]\n"
+                            "       [--no-dirty] [--strips] [--tick T (--ppm out.ppm | --golden ref.ppm)]\n"
+                            "       [--screens DIR]\n", argv[0]);
+            return 2;
+        }
+        ++i;
+    }
+
+    // What a thread needs before drawing anything, taken off the peak
+    memset(renderStack, STACK_PAINT, sizeof(renderStack));
+    DrawOnRenderStack(DrawNothing, NULL);
+    uint32_t threadStack = RenderStackPeak();
+    memset(renderStack, STACK_PAINT, sizeof(renderStack));
+
+    LCD_Init();
+    gameState.autopilot = true;
+    FakeMonitorStats(0);
+
+    FrameStats play, kil;
+    uint64_t publishNs = 0, publishMaxNs = 0;   // snek task side, PublishFrame()
+    int32_t goldenDiff = 0;
+    bool shot = false;
+
+    for (uint32_t n = 0; n < games; ++n) {
+        ResetGame(seed + n);
+        uint8_t events = EVENT_NONE;
+        while (!(events & (EVENT_DIED | EVENT_WON)) && gGame.ticks() < maxTicks) {
+            events = gGame.step(gAutopilot.decide(gGame));
+            gameState.speedLevel = SpeedLevel(gGame.score());
+            gameTimeMs += kSnekPeriodMs[gameState.speedLevel];
+            if (gGame.ticks() % 29 == 0) FakeMonitorStats(gGame.ticks() / 29);
+
+            uint64_t t0 = HostNanos();
+            PublishFrame();
+            uint64_t ns = HostNanos() - t0;
+            publishNs += ns;
+            if (ns > publishMaxNs) publishMaxNs = ns;
+
+            MemDisplay_ResetStats();
+            LcdCounts before = LcdCounts::now();
+            play.add(DrawOnRenderStack(DrawGame, gFrames.acquire()), before);
+
+            if (n == 0 && !shot && gGame.ticks() == shotTick) {
+                shot = true;
+                if (ppmPath && !MemDisplay_WritePpm(ppmPath, gMemPanel)) {
+                    fprintf(stderr, "cannot write %s\n", ppmPath);
+                    return 1;
+                }
+                if (goldenPath) goldenDiff = MemDisplay_ComparePpm(goldenPath, gMemPanel);
+            }
+        }
+        if (gGame.score() > highScore) highScore = gGame.score();
+
+        gameState.snekIsKil  = (events & EVENT_DIED) != 0;
+        gameState.snekHasWon = (events & EVENT_WON) != 0;
+        PublishFrame();
+        MemDisplay_ResetStats();
+        LcdCounts before = LcdCounts::now();
+        kil.add(DrawOnRenderStack((events & EVENT_WON) ? DrawWinScren : DrawKilScren,
+                                  gFrames.acquire()), before);
+    }
+
+    DrawOnRenderStack(DrawOverflow, NULL);
+
+    printf("board %ux%u  games %u  %s render, %s%s flush%s\n",
+           BoardConfig::kWidth, BoardConfig::kHeight, games,
+           gIncrementalRender ? "incremental" : "full", gStripRender ? "strip" : "screen buffer, ",
+           gStripRender ? "" : (gDirtyFlush ? "dirty-rect" : "full"),
+           debugMode ? ", debug overlay" : "");
+    printf("publish   %8.1f ns avg %8.1f ns max (snek task, per tick)\n",
+           play.frames ? (double)publishNs / play.frames : 0.0, (double)publishMaxNs);
+    play.print("game");
+    kil.print("end");
+    PrintProfile();
+    if (gStripRender) {
+        printf("panel mismatches after flush: not checked in strip mode\n");
+    } else {
+        printf("panel mismatches after flush: %llu frames\n",
+               (unsigned long long)(play.panelBad + kil.panelBad));
+    }
+    // The screen buffer is lcd_dirty.cpp's indexed one, the same 16 KB
+    // on the board
+    uint32_t bufferBytes = gStripRender ? LCD_STRIP_BYTES : MEM_LCD_WIDTH * MEM_LCD_HEIGHT;
+    uint32_t stackBytes  = RenderStackPeak() - threadStack;
+    printf("display RAM: %s %u B + peak draw stack %u B = %u B\n",
+           gStripRender ? "strip" : "screen buffer", bufferBytes, stackBytes, bufferBytes + stackBytes);
+
+    if (screensDir && !WriteScreens(screensDir)) {
+        fprintf(stderr, "cannot write screens to %s\n", screensDir);
+        return 1;
+    }
+    if ((ppmPath || goldenPath) && !shot) {
+        fprintf(stderr, "first game ended before tick %u\n", shotTick);
+        return 1;
+    }
+    if (goldenPath) {
+        if (goldenDiff < 0) {
+            fprintf(stderr, "cannot read %s\n", goldenPath);
+            return 1;
+        }
+        printf("golden %s: %d pixels differ\n", goldenPath, goldenDiff);
+        if (goldenDiff) return 1;
+    }
+    return (play.panelBad + kil.panelBad) ? 1 : 0;
+}
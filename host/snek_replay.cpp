@@ -0,0 +1,193 @@
+// Host-side replay of an input log taken from the board. Rebuilds the game
+// from the recorded seed and direction changes at full speed and checks
+// that it ends on the same tick, score and outcome as it did on the board,
+// so a field bug can be reproduced (and stepped through in a debugger)
+// without a screen capture.
+//
+// Build (from the project root):
+//   g++ -O2 -std=c++14 -I. host/snek_replay.cpp -o snek_replay
+// Use the same -DSNEK_GRID_SIZE and -DINPUT_LOG_CAPACITY as the firmware.
+//
+// Getting a log off the board: after the game ends, halt in CCS and save
+// sizeof(InputLog) bytes of memory starting at &gInputLog as raw binary.
+//
+// Usage:
+//   snek_replay [--trace] [--repeat N] [--max-ticks M] log.bin
+//   snek_replay --record SEED out.bin
+//
+// --trace prints head, length and events for every tick. --repeat replays
+// the log N times and reports replays/s. --record plays a random game
+// with the given seed and writes its log, to exercise the path without a
+// board.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "game_config.h"
+#include "game_engine.h"
+#include "input_log.h"
+#include "snek_rng.h"
+
+typedef GameEngine<BoardConfig> Engine;
+
+static const Direction kOpposite[4] = { DOWN, UP, RIGHT, LEFT };
+static const char* const kDirName[4] = { "UP", "DOWN", "LEFT", "RIGHT" };
+
+static void Usage(const char* argv0)
+{
+    fprintf(stderr,
+            "usage: %s [--trace] [--repeat N] [--max-ticks M] log.bin\n"
+            "       %s --record SEED out.bin\n", argv0, argv0);
+    exit(2);
+}
+
+static bool ReadLog(const char* path, InputLog* log)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    size_t n = fread(log, 1, sizeof(*log), f);
+    fclose(f);
+
+    if (n != sizeof(*log)) {
+        fprintf(stderr, "%s: %zu bytes, expected %zu (INPUT_LOG_CAPACITY mismatch?)\n",
+                path, n, sizeof(*log));
+        return false;
+    }
+    if (!InputLog_IsValid(log)) {
+        fprintf(stderr, "%s: not an input log (magic %08x version %u)\n",
+                path, log->magic, log->version);
+        return false;
+    }
+    return true;
+}
+
+static bool WriteLog(const char* path, const InputLog* log)
+{
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    bool ok = fwrite(log, 1, sizeof(*log), f) == sizeof(*log);
+    fclose(f);
+    return ok;
+}
+
+// Random game recorded the way vsnekTask records one: a log entry each
+// time the direction changes, taken before the step it applies to.
+static int Record(uint32_t seed, const char* path, uint32_t maxTicks)
+{
+    static InputLog log;
+    Engine game(seed);
+    SnekRng policy(seed ^ 0x5EED5EEDu);
+    InputLog_Begin(&log, seed);
+
+    Direction dir = RIGHT;
+    uint8_t events = EVENT_NONE;
+    while (!(events & (EVENT_DIED | EVENT_WON)) && game.ticks() < maxTicks) {
+        if (policy.below(4) == 0) {
+            Direction d = (Direction)policy.below(4);
+            if (d != dir && d != kOpposite[dir]) {
+                dir = d;
+                InputLog_Record(&log, game.ticks(), dir);
+            }
+        }
+        events = game.step(dir);
+    }
+    InputLog_End(&log, game.ticks(), game.score(), events);
+
+    if (!WriteLog(path, &log)) return 1;
+    printf("recorded seed %u: %u changes, %u ticks, score %u%s\n",
+           seed, log.count, log.endTick, log.endScore,
+           log.overflowed ? " (log overflowed)" : "");
+    return 0;
+}
+
+static void Trace(const InputLog* log, uint32_t maxTicks)
+{
+    Engine game;
+    InputLogPlayer player;
+    InputLog_PlayerInit(&player, log);
+    game.reset(log->seed);
+
+    uint8_t events = EVENT_NONE;
+    while (!(events & (EVENT_DIED | EVENT_WON)) && game.ticks() < maxTicks) {
+        Direction d = InputLog_PlayerDirection(&player, game.ticks());
+        events = game.step(d);
+        Engine::Position h = game.headPos();
+        printf("%6u %-5s head %2u,%2u  len %3u%s%s%s\n", game.ticks(), kDirName[d],
+               h.x, h.y, game.length(),
+               (events & EVENT_ATE) ? "  ATE" : "", (events & EVENT_DIED) ? "  DIED" : "",
+               (events & EVENT_WON) ? "  WON" : "");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool trace = false;
+    uint32_t repeat = 1;
+    uint32_t maxTicks = 10000000;
+    const char* path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if      (!strcmp(a, "--trace"))     trace = true;
+        else if (!strcmp(a, "--repeat") && v)    { repeat = (uint32_t)strtoul(v, NULL, 0); ++i; }
+        else if (!strcmp(a, "--max-ticks") && v) { maxTicks = (uint32_t)strtoul(v, NULL, 0); ++i; }
+        else if (!strcmp(a, "--record") && v && i + 2 < argc) {
+            return Record((uint32_t)strtoul(v, NULL, 0), argv[i + 2], maxTicks);
+        }
+        else if (a[0] != '-' && !path) path = a;
+        else Usage(argv[0]);
+    }
+    if (!path || repeat == 0) Usage(argv[0]);
+
+    static InputLog log;
+    if (!ReadLog(path, &log)) return 1;
+
+    printf("board %ux%u  seed %u  changes %u\n",
+           BoardConfig::kWidth, BoardConfig::kHeight, log.seed, log.count);
+    if (log.overflowed) {
+        fprintf(stderr, "log overflowed on the board: the game cannot be reproduced past entry %u\n",
+                log.count);
+        return 1;
+    }
+
+    if (trace) Trace(&log, maxTicks);
+
+    Engine game;
+    uint8_t events = EVENT_NONE;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < repeat; ++r) {
+        events = InputLog_Replay(&log, &game, maxTicks);
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    printf("replayed: %u ticks, score %u, %s\n", game.ticks(), game.score(),
+           (events & EVENT_WON) ? "won" : (events & EVENT_DIED) ? "died" : "still running");
+    if (repeat > 1 && secs > 0.0) {
+        printf("%u replays in %.3f s: %.0f replays/s, %.2f Mticks/s\n", repeat, secs,
+               repeat / secs, (double)game.ticks() * repeat / secs / 1e6);
+    }
+
+    // A log of an unfinished game (board halted mid-run) has nothing to check
+    if (log.endEvents == 0) {
+        printf("log has no recorded ending; stopped after %u ticks\n", game.ticks());
+        return 0;
+    }
+    if (game.ticks() != log.endTick || game.score() != log.endScore || events != log.endEvents) {
+        printf("MISMATCH: board ended at %u ticks, score %u, events %#x\n",
+               log.endTick, log.endScore, log.endEvents);
+        return 1;
+    }
+    printf("matches the board\n");
+    return 0;
+}
@@ -0,0 +1,357 @@
+// Host-side check and benchmark for game snapshots and the rewind buffer.
+// Plays random games, recording every tick into a RewindBuffer, rewinds
+// to random points in its window and compares the result against a game
+// re-run from the seed, and checks that the turn back onto the neck is
+// flagged right after a rewind from a death. Then times the per-tick
+// record cost (delta ticks and keyframe ticks separately), a bare
+// snapshot save/restore, and a worst-case rewind, so the cost can be
+// weighed against the 69 ms snek period. Random games die short, and snapshot and rewind cost grow with
+// length, so the same is timed again on the longest sneks there can be:
+// save/restore of a full board, and record and rewind of a snek one cell
+// short of it, stepped along a Hamiltonian cycle (host/board_cycle.h).
+//
+// Build (from the project root):
+//   g++ -O2 -std=c++14 -I. -Ihost host/snek_rewind.cpp -o snek_rewind
+// Add -DSNEK_GRID_SIZE=8/32/64 for another board size.
+//
+// Usage:
+//   snek_rewind [--games N] [--seed S]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#include "game_config.h"
+#include "game_engine.h"
+#include "rewind.h"
+#include "snek_rng.h"
+#include "board_cycle.h"
+
+typedef GameEngine<BoardConfig> Engine;
+typedef RewindBuffer<BoardConfig> Rewind;
+typedef BoardCycle<BoardConfig> Cycle;
+
+static const Direction kOpposite[4] = { DOWN, UP, RIGHT, LEFT };
+static const uint32_t  kRewindTicks = 29;   // REWIND_TICKS in game.h
+
+typedef std::chrono::steady_clock Clock;
+
+static double NsSince(Clock::time_point t0)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+}
+
+static Direction RandomMove(const Engine& g, SnekRng& rng)
+{
+    Direction d = (Direction)rng.below(4);
+    return (d == kOpposite[g.direction()]) ? (Direction)g.direction() : d;
+}
+
+static bool SameGame(const Engine& a, const Engine& b)
+{
+    if (a.ticks() != b.ticks() || a.length() != b.length() || a.score() != b.score() ||
+        a.direction() != b.direction() || a.hasFruit() != b.hasFruit() ||
+        a.isDead() != b.isDead() || a.hasWon() != b.hasWon()) {
+        return false;
+    }
+    if (a.hasFruit() && (a.fruitPos().x != b.fruitPos().x || a.fruitPos().y != b.fruitPos().y)) {
+        return false;
+    }
+    for (Engine::Length i = 0; i < a.length(); ++i) {
+        if (a.segment(i).x != b.segment(i).x || a.segment(i).y != b.segment(i).y) return false;
+    }
+    for (uint32_t c = 0; c < BoardConfig::kCells; ++c) {
+        Engine::Coord x = (Engine::Coord)(c % BoardConfig::kWidth);
+        Engine::Coord y = (Engine::Coord)(c / BoardConfig::kWidth);
+        if (a.isOccupied(x, y) != b.isOccupied(x, y)) return false;
+    }
+    return true;
+}
+
+// Re-run a game from its seed through the first `ticks` directions
+static void RunTo(Engine* g, uint32_t seed, const std::vector<Direction>& dirs, uint32_t ticks)
+{
+    g->reset(seed);
+    for (uint32_t t = 0; t < ticks; ++t) g->step(dirs[t]);
+}
+
+// Rewind to random points and check both the restored state and that the
+// game carries on exactly like the original (same fruit, same deaths)
+static uint64_t Check(uint32_t games, uint32_t seed)
+{
+    static Rewind rewind;
+    Engine game, ref;
+    SnekRng policy(seed ^ 0xBADC0FFEu);
+    uint64_t rewinds = 0;
+
+    for (uint32_t n = 0; n < games; ++n) {
+        uint32_t gameSeed = seed + n;
+        std::vector<Direction> dirs;
+        game.reset(gameSeed);
+        rewind.start(game);
+
+        uint8_t events = EVENT_NONE;
+        while (!(events & (EVENT_DIED | EVENT_WON)) && game.ticks() < 20000) {
+            Direction d = RandomMove(game, policy);
+            dirs.resize(game.ticks());
+            dirs.push_back(d);
+            events = game.step(d);
+            rewind.record(game, d, events);
+
+            // Now and then jump back somewhere in the window and carry on
+            if (policy.below(64) == 0 || (events & EVENT_DIED)) {
+                uint32_t oldest = rewind.oldestTick();
+                uint32_t target = oldest + policy.below(game.ticks() - oldest + 1);
+                if (!rewind.rewindTo(&game, target)) {
+                    fprintf(stderr, "seed %u: rewind to %u failed (window %u..%u)\n",
+                            gameSeed, target, oldest, rewind.newestTick());
+                    exit(1);
+                }
+                RunTo(&ref, gameSeed, dirs, target);
+                if (!SameGame(game, ref)) {
+                    fprintf(stderr, "seed %u: rewind to %u does not match a re-run\n",
+                            gameSeed, target);
+                    exit(1);
+                }
+                events = game.isDead() ? (uint8_t)EVENT_DIED : (uint8_t)EVENT_NONE;
+                rewinds++;
+            }
+        }
+
+        // Snapshot round trip on the final state
+        Engine::Snapshot snap;
+        game.save(&snap);
+        ref = game;
+        ref.reset(gameSeed + 1);
+        ref.restore(&snap);
+        if (!SameGame(game, ref)) {
+            fprintf(stderr, "seed %u: save/restore round trip differs\n", gameSeed);
+            exit(1);
+        }
+    }
+    return rewinds;
+}
+
+// Rewind each game from its death like RewindGame does, then feed it the
+// reverse of the restored heading: turnsBack() must flag it (vsnekTask
+// drops it there) and only it, and stepping it would kill the snek.
+static void CheckReversal(uint32_t games, uint32_t seed)
+{
+    static Rewind rewind;
+    Engine game, probe;
+    SnekRng policy(seed ^ 0x0DDBA11u);
+
+    for (uint32_t n = 0; n < games; ++n) {
+        uint32_t gameSeed = seed + n;
+        game.reset(gameSeed);
+        rewind.start(game);
+        uint8_t events = EVENT_NONE;
+        while (!(events & (EVENT_DIED | EVENT_WON)) && game.ticks() < 20000) {
+            Direction d = RandomMove(game, policy);
+            events = game.step(d);
+            rewind.record(game, d, events);
+        }
+
+        uint32_t oldest = rewind.oldestTick();
+        uint32_t target = (game.ticks() - oldest > kRewindTicks) ? game.ticks() - kRewindTicks : oldest;
+        if (!rewind.rewindTo(&game, target)) {
+            fprintf(stderr, "seed %u: rewind to %u failed\n", gameSeed, target);
+            exit(1);
+        }
+
+        Direction back = kOpposite[game.direction()];
+        for (uint8_t d = UP; d <= RIGHT; ++d) {
+            if (game.turnsBack((Direction)d) != (d == back)) {
+                fprintf(stderr, "seed %u: turnsBack(%u) wrong after rewind to heading %u\n",
+                        gameSeed, d, game.direction());
+                exit(1);
+            }
+        }
+        probe = game;
+        if (!(probe.step(back) & EVENT_DIED)) {
+            fprintf(stderr, "seed %u: reversing after a rewind did not die\n", gameSeed);
+            exit(1);
+        }
+    }
+    printf("reverse  %u rewound games flag the turn back onto the neck\n", games);
+}
+
+static void Bench(uint32_t seed)
+{
+    static Rewind rewind;
+    Engine game(seed);
+    SnekRng policy(seed);
+    rewind.start(game);
+
+    // Record cost per tick, keyframe ticks split out
+    const uint32_t kTicks = 2000000;
+    double deltaNs = 0.0, keyNs = 0.0;
+    uint32_t deltaTicks = 0, keyTicks = 0;
+    Engine longest = game;                  // snapshot cost grows with length
+    for (uint32_t i = 0; i < kTicks; ++i) {
+        Direction d = RandomMove(game, policy);
+        uint8_t events = game.step(d);
+        if (game.length() > longest.length()) longest = game;
+        if (events & (EVENT_DIED | EVENT_WON)) {
+            game.reset(seed + i);
+            rewind.start(game);
+            continue;
+        }
+        bool key = (game.ticks() % 32) == 0;
+        Clock::time_point t0 = Clock::now();
+        rewind.record(game, d, events);
+        double ns = NsSince(t0);
+        if (key) {
+            keyNs += ns; keyTicks++;
+        } else {
+            deltaNs += ns; deltaTicks++;
+        }
+    }
+
+    // Bare snapshot save and restore of the longest snek seen
+    Engine::Snapshot snap;
+    const uint32_t kReps = 1000000;
+    Clock::time_point t0 = Clock::now();
+    for (uint32_t i = 0; i < kReps; ++i) {
+        longest.save(&snap);
+        __asm__ __volatile__("" : : "r"(&snap) : "memory");
+    }
+    double saveNs = NsSince(t0) / kReps;
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < kReps; ++i) {
+        longest.restore(&snap);
+        __asm__ __volatile__("" : : "r"(&longest) : "memory");
+    }
+    double restoreNs = NsSince(t0) / kReps;
+
+    // Worst-case rewind: target one tick before the next keyframe, so the
+    // whole interval is re-stepped. Redone on a fresh copy each time.
+    Engine work;
+    uint32_t newest = rewind.newestTick();
+    uint32_t target = (newest >= 32) ? (newest / 32) * 32 - 1 : 0;
+    if (target < rewind.oldestTick()) target = rewind.oldestTick();
+    static Rewind copy;
+    double rewindNs = 0.0;
+    const uint32_t kRewinds = 100000;
+    for (uint32_t i = 0; i < kRewinds; ++i) {
+        copy = rewind;
+        work = game;
+        t0 = Clock::now();
+        copy.rewindTo(&work, target);
+        rewindNs += NsSince(t0);
+    }
+
+    printf("snapshot %zu bytes, rewind buffer %zu bytes, window %u ticks (%u keyframes x %u)\n",
+           sizeof(Engine::Snapshot), sizeof(Rewind), Rewind::kDeltas, 4u, 32u);
+    printf("record   delta tick  %8.1f ns avg\n", deltaTicks ? deltaNs / deltaTicks : 0.0);
+    printf("record   keyframe    %8.1f ns avg\n", keyTicks ? keyNs / keyTicks : 0.0);
+    printf("save     len %-5u   %8.1f ns\n", longest.length(), saveNs);
+    printf("restore  len %-5u   %8.1f ns\n", longest.length(), restoreNs);
+    printf("rewind   %2u re-steps %8.1f ns avg\n", target % 32, rewindNs / kRewinds);
+}
+
+// Save/restore one snek, averaged over reps
+static void SaveRestoreNs(Engine* g, uint32_t reps, double* saveNs, double* restoreNs)
+{
+    Engine::Snapshot snap;
+    Clock::time_point t0 = Clock::now();
+    for (uint32_t i = 0; i < reps; ++i) {
+        g->save(&snap);
+        __asm__ __volatile__("" : : "r"(&snap) : "memory");
+    }
+    *saveNs = NsSince(t0) / reps;
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < reps; ++i) {
+        g->restore(&snap);
+        __asm__ __volatile__("" : : "r"(g) : "memory");
+    }
+    *restoreNs = NsSince(t0) / reps;
+}
+
+// Worst case by length: a full board for save/restore, and a snek one
+// cell short of it moving along the cycle for record and rewind
+static void BenchLongest(void)
+{
+    static Rewind rewind;
+    static Rewind copy;
+    Engine game, work;
+    const uint32_t kReps = 200000;
+
+    Cycle::place(&game, (Engine::Length)BoardConfig::kCells, 0, false);
+    double saveNs, restoreNs;
+    SaveRestoreNs(&game, kReps, &saveNs, &restoreNs);
+    printf("save     len %-5u   %8.1f ns (full board)\n", game.length(), saveNs);
+    printf("restore  len %-5u   %8.1f ns (full board)\n", game.length(), restoreNs);
+
+    // Fill the window, then time record over further ticks
+    Cycle::place(&game, (Engine::Length)(BoardConfig::kCells - 1), 0, false);
+    rewind.start(game);
+    double deltaNs = 0.0, keyNs = 0.0;
+    uint32_t deltaTicks = 0, keyTicks = 0;
+    for (uint32_t i = 0; i < Rewind::kDeltas + kReps; ++i) {
+        Engine::Position h = game.headPos();
+        Direction d = Cycle::next(h.x, h.y);
+        uint8_t events = game.step(d);
+        bool key = (game.ticks() % 32) == 0;
+        Clock::time_point t0 = Clock::now();
+        rewind.record(game, d, events);
+        double ns = NsSince(t0);
+        if (key) {
+            keyNs += ns; keyTicks++;
+        } else {
+            deltaNs += ns; deltaTicks++;
+        }
+    }
+    if (game.isDead() || game.length() != BoardConfig::kCells - 1) {
+        fprintf(stderr, "long snek left the cycle\n");
+        exit(1);
+    }
+
+    // Rewind as far back as the window reaches, to one tick before a
+    // keyframe, so it restores the longest snek and re-steps 31 ticks
+    uint32_t target = rewind.oldestTick() + 31;
+    double rewindNs = 0.0;
+    const uint32_t kRewinds = 20000;
+    for (uint32_t i = 0; i < kRewinds; ++i) {
+        copy = rewind;
+        work = game;
+        Clock::time_point t0 = Clock::now();
+        if (!copy.rewindTo(&work, target)) {
+            fprintf(stderr, "long snek rewind to %u failed\n", target);
+            exit(1);
+        }
+        rewindNs += NsSince(t0);
+    }
+    printf("record   delta tick  %8.1f ns avg (len %u)\n", deltaNs / deltaTicks, game.length());
+    printf("record   keyframe    %8.1f ns avg (len %u)\n", keyNs / keyTicks, game.length());
+    printf("rewind   %2u re-steps %8.1f ns avg (len %u)\n", target % 32, rewindNs / kRewinds,
+           game.length());
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t games = 2000;
+    uint32_t seed  = 1;
+    for (int i = 1; i < argc; ++i) {
+        const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if      (!strcmp(argv[i], "--games") && v) { games = (uint32_t)strtoul(v, NULL, 0); ++i; }
+        else if (!strcmp(argv[i], "--seed") && v)  { seed = (uint32_t)strtoul(v, NULL, 0); ++i; }
+        else {
+            fprintf(stderr, "usage: %s [--games N] [--seed S]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("board %ux%u\n", BoardConfig::kWidth, BoardConfig::kHeight);
+    uint64_t rewinds = Check(games, seed);
+    printf("check    %u games, %llu rewinds match a re-run from the seed\n",
+           games, (unsigned long long)rewinds);
+    CheckReversal(games, seed);
+    Bench(seed);
+    BenchLongest();
+    return 0;
+}
@@ -0,0 +1,265 @@
+// Host-side batch simulator: plays many independent GameEngine games across
+// all cores and reports score/length/survival distributions plus per-thread
+// throughput, so engine changes can be load tested and regressions in
+// steps/s caught without the board.
+//
+// Build (from the project root):
+//   g++ -O2 -std=c++14 -pthread -I. host/snek_sim.cpp -o snek_sim
+// Add -DSNEK_GRID_SIZE=8/32/64 to simulate another board size.
+//
+// Usage:
+//   snek_sim [--games N] [--threads T] [--policy random|greedy]
+//            [--max-ticks M] [--seed S] [--expect-msteps X]
+//
+// Games are handed out in chunks from a shared atomic counter, so threads
+// that draw short games simply take more chunks. Game i is always seeded
+// with seed + i, so the distributions do not depend on the thread count.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "game_config.h"
+#include "game_engine.h"
+#include "snek_rng.h"
+
+typedef GameEngine<BoardConfig> Engine;
+
+enum Policy { POLICY_RANDOM, POLICY_GREEDY };
+
+struct SimOptions {
+    uint32_t games     = 100000;
+    uint32_t threads   = 0;        // 0 = hardware_concurrency
+    Policy   policy    = POLICY_GREEDY;
+    uint32_t maxTicks  = 20000;    // cap per game so a looping policy ends
+    uint32_t seed      = 1;
+    double   expectMsteps = 0.0;   // fail if any thread runs slower
+};
+
+static const uint32_t kChunk = 256;          // games per work item
+
+// Per-thread results, merged once all workers finish
+struct SimStats {
+    std::vector<uint32_t> scoreHist;   // index = final score
+    std::vector<uint32_t> tickHist;    // index = ticks survived
+    uint64_t games  = 0;
+    uint64_t steps  = 0;
+    uint64_t deaths = 0;
+    uint64_t wins   = 0;
+    uint64_t capped = 0;
+    double   seconds = 0.0;
+};
+
+static const Direction kOpposite[4] = { DOWN, UP, RIGHT, LEFT };
+
+static Engine::Position Neighbor(Engine::Position p, Direction d)
+{
+    switch (d) {
+        case UP:    p.y = (p.y == 0) ? BoardConfig::kHeight - 1 : p.y - 1; break;
+        case DOWN:  p.y = (p.y == BoardConfig::kHeight - 1) ? 0 : p.y + 1; break;
+        case LEFT:  p.x = (p.x == 0) ? BoardConfig::kWidth - 1 : p.x - 1; break;
+        case RIGHT: p.x = (p.x == BoardConfig::kWidth - 1) ? 0 : p.x + 1; break;
+    }
+    return p;
+}
+
+// Wrapped distance along one axis
+static int AxisDistance(int a, int b, int size)
+{
+    int d = abs(a - b);
+    return (d < size - d) ? d : size - d;
+}
+
+// Random policy: any direction except straight back
+static Direction RandomMove(const Engine& g, SnekRng& rng)
+{
+    Direction d = (Direction)rng.below(4);
+    return (d == kOpposite[g.direction()]) ? (Direction)g.direction() : d;
+}
+
+// Greedy policy: of the moves that do not hit the body next tick, take the
+// one closest to the fruit; ties and dead ends fall back to random.
+static Direction GreedyMove(const Engine& g, SnekRng& rng)
+{
+    Engine::Position head  = g.headPos();
+    Engine::Position fruit = g.fruitPos();
+    Direction best = RandomMove(g, rng);
+    int bestDist = 1 << 30;
+
+    uint32_t start = rng.below(4);   // rotate the scan to break ties fairly
+    for (uint32_t k = 0; k < 4; ++k) {
+        Direction d = (Direction)((start + k) & 3);
+        if (d == kOpposite[g.direction()]) continue;
+        Engine::Position n = Neighbor(head, d);
+        if (g.isOccupied(n.x, n.y)) continue;
+        int dist = AxisDistance(n.x, fruit.x, BoardConfig::kWidth) +
+                   AxisDistance(n.y, fruit.y, BoardConfig::kHeight);
+        if (dist < bestDist) {
+            bestDist = dist;
+            best = d;
+        }
+    }
+    return best;
+}
+
+static void Worker(const SimOptions& opt, std::atomic<uint32_t>& nextGame, SimStats& out)
+{
+    out.scoreHist.assign(BoardConfig::kCells + 1, 0);
+    out.tickHist.assign(opt.maxTicks + 1, 0);
+
+    Engine* g = new Engine(opt.seed);    // ~1 KB for 16x16, more for 64x64
+    auto t0 = std::chrono::steady_clock::now();
+
+    for (;;) {
+        uint32_t first = nextGame.fetch_add(kChunk);
+        if (first >= opt.games) break;
+        uint32_t last = (first + kChunk < opt.games) ? first + kChunk : opt.games;
+
+        for (uint32_t i = first; i < last; ++i) {
+            g->reset(opt.seed + i);
+            SnekRng policyRng(~(opt.seed + i));
+            uint8_t events = EVENT_NONE;
+
+            while (g->ticks() < opt.maxTicks) {
+                Direction d = (opt.policy == POLICY_GREEDY) ? GreedyMove(*g, policyRng)
+                                                            : RandomMove(*g, policyRng);
+                events = g->step(d);
+                if (events & (EVENT_DIED | EVENT_WON)) break;
+            }
+
+            out.games++;
+            out.steps += g->ticks();
+            if (events & EVENT_DIED)     out.deaths++;
+            else if (events & EVENT_WON) out.wins++;
+            else                         out.capped++;
+            out.scoreHist[g->score()]++;
+            out.tickHist[g->ticks()]++;
+        }
+    }
+
+    out.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    delete g;
+}
+
+// Value below which fraction q of the samples fall
+static uint32_t Percentile(const std::vector<uint32_t>& hist, uint64_t total, double q)
+{
+    uint64_t target = (uint64_t)(q * (double)total);
+    uint64_t seen = 0;
+    for (uint32_t v = 0; v < hist.size(); ++v) {
+        seen += hist[v];
+        if (seen > target) return v;
+    }
+    return (uint32_t)hist.size() - 1;
+}
+
+static void PrintDistribution(const char* name, const std::vector<uint32_t>& hist,
+                              uint64_t total)
+{
+    double sum = 0.0;
+    uint32_t maxV = 0;
+    for (uint32_t v = 0; v < hist.size(); ++v) {
+        sum += (double)v * hist[v];
+        if (hist[v]) maxV = v;
+    }
+    printf("%-8s mean %9.2f  p50 %7u  p90 %7u  p99 %7u  max %7u\n", name,
+           total ? sum / (double)total : 0.0,
+           Percentile(hist, total, 0.50), Percentile(hist, total, 0.90),
+           Percentile(hist, total, 0.99), maxV);
+}
+
+static void Usage(const char* argv0)
+{
+    fprintf(stderr,
+            "usage: %s [--games N] [--threads T] [--policy random|greedy]\n"
+            "          [--max-ticks M] [--seed S] [--expect-msteps X]\n", argv0);
+    exit(2);
+}
+
+int main(int argc, char** argv)
+{
+    SimOptions opt;
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!v) Usage(argv[0]);
+        if      (!strcmp(a, "--games"))         opt.games = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(a, "--threads"))       opt.threads = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(a, "--max-ticks"))     opt.maxTicks = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(a, "--seed"))          opt.seed = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(a, "--expect-msteps")) opt.expectMsteps = atof(v);
+        else if (!strcmp(a, "--policy")) {
+            if      (!strcmp(v, "random")) opt.policy = POLICY_RANDOM;
+            else if (!strcmp(v, "greedy")) opt.policy = POLICY_GREEDY;
+            else Usage(argv[0]);
+        }
+        else Usage(argv[0]);
+        ++i;
+    }
+    if (opt.maxTicks == 0) Usage(argv[0]);
+    if (opt.threads == 0) opt.threads = std::thread::hardware_concurrency();
+    if (opt.threads == 0) opt.threads = 1;
+
+    std::atomic<uint32_t> nextGame(0);
+    std::vector<SimStats> stats(opt.threads);
+    std::vector<std::thread> pool;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < opt.threads; ++t) {
+        pool.emplace_back(Worker, std::cref(opt), std::ref(nextGame), std::ref(stats[t]));
+    }
+    for (auto& th : pool) th.join();
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    // Merge per-thread results
+    SimStats all;
+    all.scoreHist.assign(BoardConfig::kCells + 1, 0);
+    all.tickHist.assign(opt.maxTicks + 1, 0);
+    for (const SimStats& s : stats) {
+        all.games += s.games;   all.steps += s.steps;
+        all.deaths += s.deaths; all.wins += s.wins; all.capped += s.capped;
+        for (size_t v = 0; v < s.scoreHist.size(); ++v) all.scoreHist[v] += s.scoreHist[v];
+        for (size_t v = 0; v < s.tickHist.size(); ++v)  all.tickHist[v] += s.tickHist[v];
+    }
+
+    printf("board %ux%u  policy %s  games %llu  threads %u  seed %u\n",
+           BoardConfig::kWidth, BoardConfig::kHeight,
+           opt.policy == POLICY_GREEDY ? "greedy" : "random",
+           (unsigned long long)all.games, opt.threads, opt.seed);
+    printf("outcome  died %llu  won %llu  hit max-ticks %llu\n",
+           (unsigned long long)all.deaths, (unsigned long long)all.wins,
+           (unsigned long long)all.capped);
+    PrintDistribution("score", all.scoreHist, all.games);
+
+    // Length is score + the starting length
+    std::vector<uint32_t> lenHist(all.scoreHist.size() + Engine::kStartLength, 0);
+    for (size_t v = 0; v < all.scoreHist.size(); ++v) lenHist[v + Engine::kStartLength] = all.scoreHist[v];
+    PrintDistribution("length", lenHist, all.games);
+    PrintDistribution("ticks", all.tickHist, all.games);
+    printf("         (1 tick = 69 ms on target at the base speed)\n");
+
+    printf("\nthread   games       steps      seconds   Msteps/s\n");
+    bool slow = false;
+    for (uint32_t t = 0; t < opt.threads; ++t) {
+        const SimStats& s = stats[t];
+        double rate = s.seconds > 0.0 ? (double)s.steps / s.seconds / 1e6 : 0.0;
+        printf("%6u %7llu %11llu %12.3f %10.2f\n", t, (unsigned long long)s.games,
+               (unsigned long long)s.steps, s.seconds, rate);
+        if (opt.expectMsteps > 0.0 && s.steps > 0 && rate < opt.expectMsteps) slow = true;
+    }
+    printf("total  %7llu %11llu %12.3f %10.2f   (%.0f games/min)\n",
+           (unsigned long long)all.games, (unsigned long long)all.steps, wall,
+           (double)all.steps / wall / 1e6, (double)all.games / wall * 60.0);
+
+    if (slow) {
+        fprintf(stderr, "FAIL: a thread ran below %.2f Msteps/s\n", opt.expectMsteps);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game_engine.h"
+
+// Input log for replays. A game is a pure function of its seed and the
+// directions fed to step(), so recording the seed plus every direction
+// change with the tick it arrived on is enough to reproduce a run exactly,
+// on the board or on a host. 4 bytes per change, no RTOS calls.
+
+#ifndef INPUT_LOG_CAPACITY
+#define INPUT_LOG_CAPACITY 512   // direction changes per game (2 KB)
+#endif
+
+#define INPUT_LOG_MAGIC   0x4C4B4E53u  // "SNKL" in memory, so a raw dump is easy to spot
+#define INPUT_LOG_VERSION 2u  // 2: fruit picked by rank over the bitboard
+
+// Entry = tick << 2 | direction. tick is the number of steps taken when
+// the change was pulled from the queue, i.e. it applies to step tick + 1.
+#define INPUT_LOG_ENTRY(tick, dir) (((uint32_t)(tick) << 2) | ((uint32_t)(dir) & 3u))
+#define INPUT_LOG_TICK(entry)      ((entry) >> 2)
+#define INPUT_LOG_DIR(entry)       ((Direction)((entry) & 3u))
+
+// Fixed layout with explicit widths so a memory dump of gInputLog taken on
+// the board (little endian) can be read straight into this struct on a host.
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t seed;          // value passed to ResetGame()
+    uint32_t count;         // entries used
+    uint32_t endTick;       // ticks when the game ended, 0 while it runs
+    uint32_t endScore;
+    uint32_t endEvents;     // EVENT_DIED or EVENT_ATE | EVENT_WON
+    uint32_t overflowed;    // changes were dropped, log cannot replay
+    uint32_t entries[INPUT_LOG_CAPACITY];
+} InputLog;
+
+// Read position while playing a log back
+typedef struct {
+    const InputLog* log;
+    uint32_t        next;   // next entry to apply
+    Direction       dir;    // direction in effect
+} InputLogPlayer;
+
+static inline void InputLog_Begin(InputLog* log, uint32_t seed)
+{
+    log->magic      = INPUT_LOG_MAGIC;
+    log->version    = INPUT_LOG_VERSION;
+    log->seed       = seed;
+    log->count      = 0;
+    log->endTick    = 0;
+    log->endScore   = 0;
+    log->endEvents  = 0;
+    log->overflowed = 0;
+}
+
+// When full we stop rather than wrap: dropping the oldest changes would make
+// everything after them unreplayable, whereas a truncated log is flagged.
+static inline void InputLog_Record(InputLog* log, uint32_t tick, Direction dir)
+{
+    if (log->count >= INPUT_LOG_CAPACITY) {
+        log->overflowed = 1;
+        return;
+    }
+    log->entries[log->count++] = INPUT_LOG_ENTRY(tick, dir);
+}
+
+static inline void InputLog_End(InputLog* log, uint32_t ticks, uint32_t score, uint8_t events)
+{
+    log->endTick   = ticks;
+    log->endScore  = score;
+    log->endEvents = events;
+}
+
+// Forget changes from `tick` on, after the game was rewound to that tick.
+// Entries are in tick order, so this only moves count back.
+static inline void InputLog_Truncate(InputLog* log, uint32_t tick)
+{
+    while (log->count > 0 && INPUT_LOG_TICK(log->entries[log->count - 1]) >= tick) {
+        log->count--;
+    }
+    log->endTick   = 0;
+    log->endScore  = 0;
+    log->endEvents = 0;
+}
+
+static inline bool InputLog_IsValid(const InputLog* log)
+{
+    return log->magic == INPUT_LOG_MAGIC && log->version == INPUT_LOG_VERSION &&
+           log->count <= INPUT_LOG_CAPACITY;
+}
+
+// A finished, complete game that can be played back
+static inline bool InputLog_CanReplay(const InputLog* log)
+{
+    return InputLog_IsValid(log) && !log->overflowed && log->endEvents != 0;
+}
+
+// Games always start heading right (see GameEngine::reset)
+static inline void InputLog_PlayerInit(InputLogPlayer* player, const InputLog* log)
+{
+    player->log  = log;
+    player->next = 0;
+    player->dir  = RIGHT;
+}
+
+// Direction to pass to the step taken after `tick` steps. Several changes
+// can land on one tick; like the live game loop, the last one wins.
+static inline Direction InputLog_PlayerDirection(InputLogPlayer* player, uint32_t tick)
+{
+    const InputLog* log = player->log;
+    while (player->next < log->count &&
+           INPUT_LOG_TICK(log->entries[player->next]) <= tick) {
+        player->dir = INPUT_LOG_DIR(log->entries[player->next]);
+        player->next++;
+    }
+    return player->dir;
+}
+
+// Play a whole log through a game as fast as possible. Returns the events
+// of the final step; the game is left in its end state. Stops after
+// maxTicks steps in case the log does not belong to this build.
+template <class Cfg>
+uint8_t InputLog_Replay(const InputLog* log, GameEngine<Cfg>* game, uint32_t maxTicks)
+{
+    InputLogPlayer player;
+    InputLog_PlayerInit(&player, log);
+    game->reset(log->seed);
+
+    uint8_t events = EVENT_NONE;
+    while (!(events & (EVENT_DIED | EVENT_WON)) && game->ticks() < maxTicks) {
+        events = game->step(InputLog_PlayerDirection(&player, game->ticks()));
+    }
+    return events;
+}
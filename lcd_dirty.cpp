@@ -0,0 +1,423 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+extern "C" {
+#include "driverlib/sysctl.h"
+#include "HAL_EK_TM4C1294XL_Crystalfontz128x128_ST7735.h"
+#include "grlib/grlib.h"
+}
+
+#include "lcd_dirty.h"
+
+// The Crystalfontz driver keeps the screen as RGB565 in its own 32 KB
+// Lcd_buffer and pushes all of it every frame. The game uses a handful of
+// colors, so this display stores a palette index per pixel in a 16 KB
+// screen of its own instead, and turns indices back into RGB565 words
+// only on the way out to SPI. Colors get an index the first time grlib
+// translates them. Panel setup is done here too, over the driver's HAL,
+// so Crystalfontz128x128_ST7735.c and its buffer are not linked at all.
+// Built with LCD_STRIP_ONLY there is no screen at all: every draw goes to
+// a strip (see lcd_dirty.h) and the flush has nothing to send.
+
+#define LCD_WIDTH  128
+#define LCD_HEIGHT 128
+#define LCD_PIXELS (LCD_WIDTH * LCD_HEIGHT)
+
+// CASET + 4 bytes, RASET + 4 bytes, RAMWR
+#define LCD_WINDOW_BYTES 11u
+
+#define LCD_COLORS 256
+
+// ST7735 commands, as the driver's init sends them
+#define ST7735_SLPOUT  0x11
+#define ST7735_NORON   0x13
+#define ST7735_GAMSET  0x26
+#define ST7735_DISPON  0x29
+#define ST7735_CASET   0x2A
+#define ST7735_RASET   0x2B
+#define ST7735_RAMWR   0x2C
+#define ST7735_MADCTL  0x36
+#define ST7735_COLMOD  0x3A
+#define ST7735_PWCTR   0xB1
+#define ST7735_STBA    0xC0
+
+// The 128x128 glass sits at column 2, row 3 of the controller's RAM when
+// mounted upright (MADCTL 0xC8: mirrored X and Y, BGR)
+#define LCD_COL0 2
+#define LCD_ROW0 3
+
+bool gDirtyFlush = true;
+
+volatile uint32_t gFlushRects  = 0;
+volatile uint32_t gFlushPixels = 0;
+volatile uint32_t gFlushBytes  = 0;
+
+volatile uint32_t gTileBlits      = 0;
+volatile uint32_t gLcdPixelWrites = 0;
+volatile uint32_t gLcdFills       = 0;
+volatile uint32_t gLcdTextRuns    = 0;
+
+#ifndef LCD_STRIP_ONLY
+static DirtyList dirty = { {}, 0, LCD_WIDTH, LCD_HEIGHT };
+#endif
+
+// Palette: index to RGB565, the fixed entries first (same order as the
+// LCD_BLACK... enum)
+static uint16_t lut[LCD_COLORS] = {
+    LCD_RGB565(ClrBlack), LCD_RGB565(ClrWhite), LCD_RGB565(ClrRed), LCD_RGB565(ClrGreen),
+    LCD_RGB565(ClrYellow), LCD_RGB565(ClrBlue), LCD_RGB565(ClrCyan),
+};
+static uint16_t lutCount = LCD_FIXED_COLORS;
+
+#ifndef LCD_STRIP_ONLY
+// Word aligned for LCD_BlitTile8
+static uint8_t screenBuf[LCD_PIXELS] __attribute__((aligned(4)));
+
+static inline uint8_t* screen(void)
+{
+    return screenBuf;
+}
+#endif
+
+// Strip mode: draws land in strip, which holds screen rows
+// stripY0..stripY0 + stripRows - 1
+static uint32_t strip[LCD_STRIP_BYTES / 4];     // words, for the tile blit
+static bool     inStrip   = false;
+static int32_t  stripY0   = 0;
+static int32_t  stripRows = 0;
+
+#ifdef LCD_STRIP_ONLY
+static inline uint8_t* pixelAt(int32_t x, int32_t y)
+{
+    return &((uint8_t*)strip)[(y - stripY0) * LCD_WIDTH + x];
+}
+
+static inline void markDirty(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    (void)x0; (void)y0; (void)x1; (void)y1;
+}
+#else
+static inline uint8_t* pixelAt(int32_t x, int32_t y)
+{
+    if (inStrip) return &((uint8_t*)strip)[(y - stripY0) * LCD_WIDTH + x];
+    return &screen()[y * LCD_WIDTH + x];
+}
+
+static inline void markDirty(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    if (!inStrip) Dirty_Add(&dirty, x0, y0, x1, y1);
+}
+#endif
+
+static uint32_t colorDistance(uint16_t a, uint16_t b)
+{
+    int32_t dr = (int32_t)(a >> 11) - (int32_t)(b >> 11);
+    int32_t dg = (int32_t)((a >> 5) & 0x3F) - (int32_t)((b >> 5) & 0x3F);
+    int32_t db = (int32_t)(a & 0x1F) - (int32_t)(b & 0x1F);
+    return (uint32_t)(dr * dr + dg * dg + db * db);
+}
+
+// Index of an RGB565 color, adding it if there is room; with the palette
+// full, the closest entry
+static uint8_t colorIndex(uint16_t c)
+{
+    for (uint16_t i = 0; i < lutCount; ++i) {
+        if (lut[i] == c) return (uint8_t)i;
+    }
+    if (lutCount < LCD_COLORS) {
+        lut[lutCount] = c;
+        return (uint8_t)lutCount++;
+    }
+    uint8_t best = 0;
+    for (uint16_t i = 1; i < LCD_COLORS; ++i) {
+        if (colorDistance(lut[i], c) < colorDistance(lut[best], c)) best = (uint8_t)i;
+    }
+    return best;
+}
+
+static inline void fillSpan(int32_t x1, int32_t x2, int32_t y, uint8_t index)
+{
+    uint8_t* p = pixelAt(x1, y);
+    for (int32_t x = x1; x <= x2; ++x) *p++ = index;
+}
+
+static void snekPixelDraw(void *pvDisplayData, int32_t i32X, int32_t i32Y, uint32_t ui32Value)
+{
+    (void)pvDisplayData;
+    *pixelAt(i32X, i32Y) = (uint8_t)ui32Value;
+    gLcdPixelWrites++;
+    markDirty(i32X, i32Y, i32X, i32Y);
+}
+
+// Palette entry of a 4 or 8 bpp image: 24-bit B,G,R, untranslated
+static uint8_t imageColor(const uint8_t *pui8Palette, uint32_t entry)
+{
+    const uint8_t* e = pui8Palette + entry * 3;
+    uint32_t rgb = ((uint32_t)e[2] << 16) | ((uint32_t)e[1] << 8) | e[0];
+    return colorIndex(LCD_RGB565(rgb));
+}
+
+static void snekPixelDrawMultiple(void *pvDisplayData, int32_t i32X, int32_t i32Y, int32_t i32X0,
+                                  int32_t i32Count, int32_t i32BPP, const uint8_t *pui8Data,
+                                  const uint8_t *pui8Palette)
+{
+    (void)pvDisplayData;
+    if (i32Count <= 0) return;
+    uint8_t* p = pixelAt(i32X, i32Y);
+    int32_t count = i32Count;
+    gLcdTextRuns++;
+    gLcdPixelWrites += (uint32_t)count;
+    markDirty(i32X, i32Y, i32X + count - 1, i32Y);
+
+    switch (i32BPP & 0xFF) {
+    case 1: {
+        // Text: the palette holds the two colors, already translated
+        const uint32_t* pal = (const uint32_t*)pui8Palette;
+        uint8_t c0 = (uint8_t)pal[0];
+        uint8_t c1 = (uint8_t)pal[1];
+        while (count > 0) {
+            uint8_t byte = *pui8Data++;
+            for (; i32X0 < 8 && count > 0; ++i32X0, --count) {
+                *p++ = ((byte >> (7 - i32X0)) & 1) ? c1 : c0;
+            }
+            i32X0 = 0;
+        }
+        break;
+    }
+    case 4:
+        while (count-- > 0) {
+            uint32_t entry = (i32X0 & 1) ? (*pui8Data++ & 0x0Fu) : (*pui8Data >> 4);
+            i32X0++;
+            *p++ = imageColor(pui8Palette, entry);
+        }
+        break;
+    case 8:
+        while (count-- > 0) {
+            *p++ = imageColor(pui8Palette, *pui8Data++);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void snekLineDrawH(void *pvDisplayData, int32_t i32X1, int32_t i32X2, int32_t i32Y, uint32_t ui32Value)
+{
+    (void)pvDisplayData;
+    fillSpan(i32X1, i32X2, i32Y, (uint8_t)ui32Value);
+    gLcdPixelWrites += (uint32_t)(i32X2 - i32X1 + 1);
+    markDirty(i32X1, i32Y, i32X2, i32Y);
+}
+
+static void snekLineDrawV(void *pvDisplayData, int32_t i32X, int32_t i32Y1, int32_t i32Y2, uint32_t ui32Value)
+{
+    (void)pvDisplayData;
+    uint8_t* p = pixelAt(i32X, i32Y1);
+    for (int32_t y = i32Y1; y <= i32Y2; ++y) {
+        *p = (uint8_t)ui32Value;
+        p += LCD_WIDTH;
+    }
+    gLcdPixelWrites += (uint32_t)(i32Y2 - i32Y1 + 1);
+    markDirty(i32X, i32Y1, i32X, i32Y2);
+}
+
+static void snekRectFill(void *pvDisplayData, const tRectangle *psRect, uint32_t ui32Value)
+{
+    (void)pvDisplayData;
+    for (int32_t y = psRect->i16YMin; y <= psRect->i16YMax; ++y) {
+        fillSpan(psRect->i16XMin, psRect->i16XMax, y, (uint8_t)ui32Value);
+    }
+    gLcdFills++;
+    gLcdPixelWrites += (uint32_t)(psRect->i16XMax - psRect->i16XMin + 1) *
+                       (uint32_t)(psRect->i16YMax - psRect->i16YMin + 1);
+    markDirty(psRect->i16XMin, psRect->i16YMin, psRect->i16XMax, psRect->i16YMax);
+}
+
+// grlib colors (and so the values handed back to the calls above) are
+// palette indices
+static uint32_t snekColorTranslate(void *pvDisplayData, uint32_t ui32Value)
+{
+    (void)pvDisplayData;
+    return colorIndex(LCD_RGB565(ui32Value));
+}
+
+static void sendWindowArgs(uint8_t command, uint16_t lo, uint16_t hi)
+{
+    HAL_LCD_writeCommand(command);
+    HAL_LCD_writeData((uint8_t)(lo >> 8));
+    HAL_LCD_writeData((uint8_t)lo);
+    HAL_LCD_writeData((uint8_t)(hi >> 8));
+    HAL_LCD_writeData((uint8_t)hi);
+}
+
+// Send one rectangle of src (which starts at screen row srcY0): set the
+// panel's column/row window, then stream its pixels through the palette,
+// high byte first
+static void sendRect(const DirtyRect* r, const uint8_t* src, int32_t srcY0)
+{
+    sendWindowArgs(ST7735_CASET, (uint16_t)(r->x0 + LCD_COL0), (uint16_t)(r->x1 + LCD_COL0));
+    sendWindowArgs(ST7735_RASET, (uint16_t)(r->y0 + LCD_ROW0), (uint16_t)(r->y1 + LCD_ROW0));
+    HAL_LCD_writeCommand(ST7735_RAMWR);
+    for (int32_t y = r->y0; y <= r->y1; ++y) {
+        const uint8_t* row = &src[(y - srcY0) * LCD_WIDTH];
+        for (int32_t x = r->x0; x <= r->x1; ++x) {
+            uint16_t c = lut[row[x]];
+            HAL_LCD_writeData((uint8_t)(c >> 8));
+            HAL_LCD_writeData((uint8_t)c);
+        }
+    }
+}
+
+static void snekFlush(void *pvDisplayData)
+{
+    (void)pvDisplayData;
+#ifdef LCD_STRIP_ONLY
+    // Strips went out as they were finished
+    gFlushRects  = 0;
+    gFlushPixels = 0;
+    gFlushBytes  = 0;
+#else
+    if (!gDirtyFlush) {
+        static const DirtyRect full = { 0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1 };
+        sendRect(&full, screen(), 0);
+        gFlushRects  = 1;
+        gFlushPixels = LCD_PIXELS;
+        gFlushBytes  = LCD_PIXELS * 2u + LCD_WINDOW_BYTES;
+        Dirty_Clear(&dirty);
+        return;
+    }
+
+    for (uint8_t i = 0; i < dirty.count; ++i) {
+        sendRect(&dirty.rects[i], screen(), 0);
+    }
+    gFlushRects  = dirty.count;
+    gFlushPixels = Dirty_Pixels(&dirty);
+    gFlushBytes  = gFlushPixels * 2u + dirty.count * LCD_WINDOW_BYTES;
+    Dirty_Clear(&dirty);
+#endif
+}
+
+void LCD_PanelInit(void)
+{
+    HAL_LCD_PortInit();
+    HAL_LCD_SpiInit();
+
+    HAL_LCD_writeCommand(ST7735_SLPOUT);
+    SysCtlDelay(4800000);                  // 120 ms at 120 MHz, 3 cycles a loop
+    HAL_LCD_writeCommand(ST7735_GAMSET);
+    HAL_LCD_writeData(0x04);
+    HAL_LCD_writeCommand(ST7735_PWCTR);
+    HAL_LCD_writeData(0x0A);
+    HAL_LCD_writeData(0x14);
+    HAL_LCD_writeCommand(ST7735_STBA);
+    HAL_LCD_writeData(0x0A);
+    HAL_LCD_writeData(0x00);
+    HAL_LCD_writeCommand(ST7735_COLMOD);
+    HAL_LCD_writeData(0x05);               // 16 bits per pixel
+    SysCtlDelay(400);
+    HAL_LCD_writeCommand(ST7735_MADCTL);
+    HAL_LCD_writeData(0xC8);               // upright
+    HAL_LCD_writeCommand(ST7735_NORON);
+    SysCtlDelay(400);
+    HAL_LCD_writeCommand(ST7735_DISPON);
+}
+
+bool LCD_BlitTile8(int32_t x, int32_t y, const Tile8* tile)
+{
+    // In a strip, only the tile rows that fall in it
+    int32_t r0 = 0, r1 = TILE_SIZE;
+    if (inStrip) {
+        if (y < stripY0) r0 = stripY0 - y;
+        if (y + r1 > stripY0 + stripRows) r1 = stripY0 + stripRows - y;
+    }
+    uint32_t* row = (uint32_t*)pixelAt(x, y + r0);
+    if (((uintptr_t)row & 3u) != 0) return false;
+    for (int32_t r = r0; r < r1; ++r) {
+        row[0] = tile->px[r][0];
+        row[1] = tile->px[r][1];
+        row += LCD_WIDTH / 4;
+    }
+    markDirty(x, y, x + TILE_SIZE - 1, y + TILE_SIZE - 1);
+    gTileBlits++;
+    return true;
+}
+
+bool LCD_DrawRle(const RleImage* image)
+{
+    if (image->length == 0) return false;
+
+    uint8_t index[4];
+    for (uint8_t i = 0; i < 4; ++i) index[i] = colorIndex(image->palette[i]);
+
+    // Pixels from..to-1 of the screen land in out; in a strip the runs
+    // before it are skipped and the decoder stops after it
+#ifdef LCD_STRIP_ONLY
+    uint8_t* out  = (uint8_t*)strip;
+    uint32_t from = (uint32_t)(stripY0 * LCD_WIDTH);
+    uint32_t to   = from + (uint32_t)(stripRows * LCD_WIDTH);
+#else
+    uint8_t* out  = inStrip ? (uint8_t*)strip : screen();
+    uint32_t from = inStrip ? (uint32_t)(stripY0 * LCD_WIDTH) : 0;
+    uint32_t to   = inStrip ? from + (uint32_t)(stripRows * LCD_WIDTH) : LCD_PIXELS;
+#endif
+
+    const uint8_t* p   = image->data;
+    const uint8_t* end = p + image->length;
+    uint32_t pos = 0;
+    while (p < end && pos < to) {
+        uint8_t run = *p++;
+        uint8_t color = index[run >> 6];
+        uint32_t n = run & 0x3Fu;
+        if (n == 0) {
+            n = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+            p += 2;
+        }
+        uint32_t a = (pos > from) ? pos : from;
+        uint32_t b = (pos + n < to) ? pos + n : to;
+        for (uint32_t i = a; i < b; ++i) out[i - from] = color;
+        pos += n;
+    }
+    gLcdPixelWrites += to - from;
+    markDirty(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+    return true;
+}
+
+void LCD_StripBegin(int32_t y0)
+{
+    inStrip   = true;
+    stripY0   = y0;
+    stripRows = (y0 + LCD_STRIP_ROWS <= LCD_HEIGHT) ? LCD_STRIP_ROWS : LCD_HEIGHT - y0;
+}
+
+void LCD_StripEnd(void)
+{
+    DirtyRect r = { 0, (int16_t)stripY0, LCD_WIDTH - 1, (int16_t)(stripY0 + stripRows - 1) };
+    sendRect(&r, (const uint8_t*)strip, stripY0);
+    inStrip = false;
+}
+
+#ifndef LCD_STRIP_ONLY
+void LCD_ReadScreen(uint16_t* out)
+{
+    for (uint32_t i = 0; i < LCD_PIXELS; ++i) out[i] = lut[screen()[i]];
+}
+#endif
+
+const tDisplay g_sSnekDisplay = {
+    sizeof(tDisplay),
+#ifdef LCD_STRIP_ONLY
+    NULL,
+#else
+    &dirty,
+#endif
+    LCD_WIDTH,
+    LCD_HEIGHT,
+    snekPixelDraw,
+    snekPixelDrawMultiple,
+    snekLineDrawH,
+    snekLineDrawV,
+    snekRectFill,
+    snekColorTranslate,
+    snekFlush
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+extern "C" {
+#include "grlib/grlib.h"
+}
+
+#include "dirty_rects.h"
+
+// grlib display for the Crystalfontz128x128 panel that keeps the screen as
+// one palette index per pixel (16 KB) and remembers which rectangles were
+// touched. Its flush expands only those rectangles to RGB565 through the
+// palette and sends them to the ST7735 instead of the whole screen. Only
+// the driver's HAL (SPI and the data/command pins) is used.
+extern const tDisplay g_sSnekDisplay;
+
+// Wake the panel and set it up upright, 16 bits per pixel. What it shows
+// until the first flush is undefined.
+void LCD_PanelInit(void);
+
+extern bool gDirtyFlush;               // false: flush the whole screen every time
+
+// Last flush, readable in the debugger
+extern volatile uint32_t gFlushRects;
+extern volatile uint32_t gFlushPixels;
+extern volatile uint32_t gFlushBytes;  // pixel data plus window setup
+
+// Driver color translation (ClrXxx to RGB565), usable in constant tables
+#define LCD_RGB565(c) ((uint16_t)((((c) & 0x00F80000u) >> 8) | \
+                                  (((c) & 0x0000FC00u) >> 5) | \
+                                  (((c) & 0x000000F8u) >> 3)))
+
+// Palette entries that are always there, so constant tables can hold
+// indices. Any other color grlib asks for is added after these.
+enum {
+    LCD_BLACK, LCD_WHITE, LCD_RED, LCD_GREEN, LCD_YELLOW, LCD_BLUE, LCD_CYAN,
+    LCD_FIXED_COLORS
+};
+
+// 8x8 sprite of palette indices, four pixels per word (leftmost pixel in
+// the low byte, as a little-endian store lays them out)
+#define TILE_SIZE 8
+typedef struct {
+    uint32_t px[TILE_SIZE][TILE_SIZE / 4];
+} Tile8;
+
+// Copy a tile straight into the screen with word stores and mark it dirty;
+// no grlib color translation or clipping. x must be a multiple of 4 and
+// the tile on screen. Returns false, drawing nothing, if the target is
+// not word aligned (it always is for such an x).
+bool LCD_BlitTile8(int32_t x, int32_t y, const Tile8* tile);
+
+// Full-screen image as palette runs, for screens that never change (see
+// screen_art.h). Each run is one byte: image palette entry in the top two
+// bits and length 1..63 in the low six; a length of 0 means the real
+// length follows as two bytes, low byte first. Runs fill the screen in
+// row order and together cover every pixel.
+typedef struct {
+    uint16_t palette[4];    // RGB565
+    uint16_t length;        // bytes of data; 0 = no image
+    const uint8_t* data;
+} RleImage;
+
+// Expand an image straight into the screen and mark it all dirty. Runs in
+// a few words of stack and no grlib, so it is safe from the stack overflow
+// hook. Returns false, drawing nothing, for an empty image.
+bool LCD_DrawRle(const RleImage* image);
+
+// Strip mode: compose the screen LCD_STRIP_ROWS rows at a time in a small
+// buffer and send each strip before starting the next, so no screen
+// buffer is needed. Between LCD_StripBegin and LCD_StripEnd every draw
+// (grlib, tiles, run images) goes to the strip, and must stay within its
+// rows: clip grlib to them. The strip starts out undefined, nothing is
+// marked dirty and the screen buffer is left as it was.
+//
+// Define LCD_STRIP_ONLY (-DLCD_STRIP_ONLY, with display.cpp built the same
+// way) to leave the 16 KB screen buffer out: strips are then the only
+// mode, any draw must come between LCD_StripBegin and LCD_StripEnd, and
+// LCD_ReadScreen does not exist.
+#define LCD_STRIP_ROWS  8
+#define LCD_STRIP_BYTES (LCD_STRIP_ROWS * 128u)
+void LCD_StripBegin(int32_t y0);
+void LCD_StripEnd(void);            // send the strip to the panel
+
+// The screen as RGB565, row by row (128 * 128 words): what the panel shows
+// after a flush. For host tools.
+#ifndef LCD_STRIP_ONLY
+void LCD_ReadScreen(uint16_t* out);
+#endif
+
+// Running counts, for the host benchmark
+extern volatile uint32_t gTileBlits;
+extern volatile uint32_t gLcdPixelWrites;  // pixels stored by grlib calls and run images
+extern volatile uint32_t gLcdFills;        // rectangle fills
+extern volatile uint32_t gLcdTextRuns;     // pfnPixelDrawMultiple (text)
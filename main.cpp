@@ -28,6 +28,8 @@ extern "C" {
 #include "app_objects.h"
 #include "game.h"
 #include "display.h"
+#include "digits.h"
+#include "render_profile.h"
 
 extern "C" void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName) {
     GPIOPinWrite(GPIO_PORTN_BASE, RED_LED, 1);
@@ -50,6 +52,7 @@ static Joystick gJoystick(JSX, JSY, JS1);
 
 // Config
 #define INPUT_TICK_MS 20U
+#define RENDER_MIN_PERIOD_MS 0U   // frame-rate cap; 0 draws every new state at once
 
 // debug tomfoolery
 bool debugMode = false;
@@ -65,7 +68,13 @@ uint8_t render_cpu;
 uint8_t input_cpu;
 uint8_t gCpuUtil;
 
-uint8_t renderMailbox;
+TaskCpuInfo gTaskCpuInfo[MAX_TASKS];
+StackInfo stackInput;
+StackInfo stackSnake;
+StackInfo stackRender;
+StackInfo stackMonitor;
+StackInfo stackTimer;
+
 
 // Prototypes
 static void configureSystemClock(void);
@@ -76,18 +85,23 @@ static void MonitorTask(void *pvParameters);
 
 void Timing_Init(void);
 uint32_t micros(void);
-void Timing_PeriodTick(void);
+void Timing_PeriodTick(uint8_t level);
+void Timing_PeriodBreak(void);
+static void Timing_ResetPeriodStats(uint8_t level);
 void Timing_ExecutionStart(void);
 void Timing_ExecutionEnd(void);
 void ChronoCallback(TimerHandle_t xTimer);
 
-// Timing measurement state
-volatile uint32_t last_us = 0;               // Last timestamp
-volatile uint32_t min_period_us = 0xFFFFFFFF;
-volatile uint32_t max_period_us = 0;
-volatile uint64_t sum_period_us = 0;         // For averaging
-volatile uint32_t period_count  = 0;
-volatile int32_t  last_jitter_us = 0;        // Signed jitter
+// Timing measurement state. Period counters are kept per speed level: a
+// period is filed under the level it ran at and judged against that
+// level's expected period.
+volatile uint32_t last_us = 0;               // Last step, 0 = none to measure from
+volatile uint32_t min_period_us[SPEED_LEVELS];
+volatile uint32_t max_period_us[SPEED_LEVELS];
+volatile uint64_t sum_period_us[SPEED_LEVELS];   // For averaging
+volatile uint32_t period_count[SPEED_LEVELS];
+volatile int32_t  last_jitter_us[SPEED_LEVELS];  // Signed jitter
+volatile uint32_t max_jitter_us[SPEED_LEVELS];   // Largest |jitter|
 
 // NEW: Execution time measurement
 volatile uint32_t last_exec_start_us = 0;
@@ -96,9 +110,9 @@ volatile uint32_t max_exec_us = 0;
 volatile uint64_t sum_exec_us = 0;
 volatile uint32_t exec_count = 0;
 
-uint32_t expected_period_us = 38000;         // Set per task being measured
 
 // Global shared variables for display
+LevelTiming gLevelTiming[SPEED_LEVELS];      // last window each level ran in
 volatile uint32_t gAvgPeriodUs = 0;
 volatile int32_t  gLastJitterSnapshot = 0;
 volatile uint32_t gAvgExecUs = 0;
@@ -107,11 +121,44 @@ volatile uint32_t gMaxExecUs = 0;
 // Add to your global variables
 volatile uint32_t gFrameCount = 0;
 volatile uint32_t gCurrentFPS = 0;
+volatile uint32_t gStatsSeq = 0;             // bumped each time MonitorTask publishes
+
+// Worst-case rewind cost seen in vsnekTask (read in the debugger)
+volatile uint32_t gRewindRecordMaxUs = 0;   // per-tick delta/keyframe
+volatile uint32_t gRewindMaxUs = 0;         // restore + re-step
+
+// Jingles, in flash; each plays as one queue entry (see buzzer.h)
+static const BuzzerNote kSoundPause[]     = { { 250, 50 }, BUZZER_END };
+static const BuzzerNote kSoundReset[]     = { { 500, 50 }, BUZZER_END };
+static const BuzzerNote kSoundAutopilot[] = { { 1000, 30 }, BUZZER_END };
+static const BuzzerNote kSoundFruit[]     = { { 250, 15 }, { 750, 30 }, { 250, 15 }, BUZZER_END };
 
 // Global timer objects
 TimerHandle_t chronoTimer = NULL;
 volatile uint32_t gameTimeMs = 0;
 
+// Step-to-flush latency: the snek task stamps a step, the render task
+// measures from there to the end of the frame it drew for it
+volatile uint32_t gStepDoneUs = 0;
+volatile uint32_t gFrameLatencyUs = 0;       // last frame
+volatile uint32_t gFrameLatencyAvgUs = 0;    // last monitor window
+volatile uint32_t gFrameLatencyMaxUs = 0;    // last monitor window
+static volatile uint32_t latency_max_us = 0;
+static volatile uint64_t latency_sum_us = 0;
+static volatile uint32_t latency_count = 0;
+
+// Input-to-flush latency: the input task stamps a queued stick change, the
+// snek task passes the stamp on with the step that took it, and the render
+// task measures to the end of that frame. Add up to INPUT_TICK_MS of stick
+// sampling for input-to-photon. host/snek_latency models both render paths.
+volatile uint32_t gInputQueuedUs = 0;
+static volatile uint32_t frame_input_us = 0; // input stamp of the published frame, 0 if none
+volatile uint32_t gInputLatencyAvgUs = 0;    // last monitor window
+volatile uint32_t gInputLatencyMaxUs = 0;    // last monitor window
+static volatile uint32_t input_latency_max_us = 0;
+static volatile uint64_t input_latency_sum_us = 0;
+static volatile uint32_t input_latency_count = 0;
+
 
 int main(void) {
     IntMasterDisable();
@@ -140,11 +187,12 @@ int main(void) {
     gJoystick.setDeadzone(0.15f);
     
     Timing_Init();
+    for (uint8_t i = 0; i < SPEED_LEVELS; i++) Timing_ResetPeriodStats(i);
     IntMasterEnable();
 
     // Create tasks (priorities per lab suggestion)
     xTaskCreate(vInputTask,  "Input",  67, NULL, 4, &hInput);
-    xTaskCreate(vsnekTask,  "Snek", 29, NULL, 2, &hSnake);
+    xTaskCreate(vsnekTask,  "Snek", 64, NULL, 2, &hSnake);
     xTaskCreate(vRenderTask, "Render", 350, NULL, 3, &hRender);
     xTaskCreate(MonitorTask, "Monitor", 73, NULL, 1, &hMonitor);
     
@@ -207,28 +255,50 @@ uint32_t micros(void)
     // Convert ticks to microseconds: system clock is 120 MHz
     return ticks / (gSysClk / 1000000);
 }
-void Timing_PeriodTick(void)
+// Called by vsnekTask before each step. level is the one its last
+// vTaskDelayUntil ran at, so the expected period is that level's snek
+// period.
+void Timing_PeriodTick(uint8_t level)
 {
     uint32_t now_us = micros();
 
-    if (last_us != 0)  // Skip first measurement
+    if (last_us != 0)  // Skip the first step after a break
     {
         // Calculate actual period
         uint32_t actual_us = now_us - last_us;
 
         // Calculate jitter (signed)
-        last_jitter_us = (int32_t)actual_us - (int32_t)expected_period_us;
+        int32_t jitter = (int32_t)actual_us - (int32_t)(kSnekPeriodMs[level] * 1000u);
+        uint32_t absJitter = (jitter < 0) ? (uint32_t)-jitter : (uint32_t)jitter;
+        last_jitter_us[level] = jitter;
 
         // Update statistics
-        if (actual_us < min_period_us) min_period_us = actual_us;
-        if (actual_us > max_period_us) max_period_us = actual_us;
-        sum_period_us += actual_us;
-        period_count++;
+        if (actual_us < min_period_us[level]) min_period_us[level] = actual_us;
+        if (actual_us > max_period_us[level]) max_period_us[level] = actual_us;
+        if (absJitter > max_jitter_us[level]) max_jitter_us[level] = absJitter;
+        sum_period_us[level] += actual_us;
+        period_count[level]++;
     }
 
     last_us = now_us;
 }
 
+// Steps stopped (pause, kil/win, reset, replay, rewind): the next step
+// starts a new measurement instead of counting the gap as one period
+void Timing_PeriodBreak(void)
+{
+    last_us = 0;
+}
+
+static void Timing_ResetPeriodStats(uint8_t level)
+{
+    min_period_us[level] = 0xFFFFFFFFu;
+    max_period_us[level] = 0u;
+    sum_period_us[level] = 0u;
+    period_count[level]  = 0u;
+    max_jitter_us[level] = 0u;
+}
+
 void Timing_ExecutionStart(void)
 {
     last_exec_start_us = micros();
@@ -266,14 +336,25 @@ void ChronoCallback(TimerHandle_t xTimer)
     // If game is paused, time doesn't advance
 }
 
+// mm:ss:cc; bufSize must allow 5 minute digits (12 chars) or the
+// buffer is left empty
 void FormatGameTime(char* buffer, size_t bufSize, uint32_t timeMs) {
+    if (bufSize < 12) {
+        if (bufSize) buffer[0] = '\0';
+        return;
+    }
     uint32_t totalCs      = timeMs / 10;
     uint32_t minutes      = totalCs / 6000;
-    uint32_t remainingCs  = totalCs % 6000;
-    uint32_t seconds      = remainingCs/100;
-    uint32_t centiseconds = remainingCs % 100;
-
-    snprintf(buffer, bufSize, "%02lu:%02lu:%02lu", minutes, seconds, centiseconds);
+    uint32_t remainingCs  = totalCs - minutes * 6000;
+    uint32_t seconds      = remainingCs / 100;
+    uint32_t centiseconds = remainingCs - seconds * 100;
+
+    char* p = (minutes < 100) ? Digits_Pad(buffer, minutes, 2) : Digits_U32(buffer, minutes);
+    *p++ = ':';
+    p = Digits_Pad(p, seconds, 2);
+    *p++ = ':';
+    p = Digits_Pad(p, centiseconds, 2);
+    Digits_End(p);
 }
 
 //Task Manager Functions
@@ -318,26 +399,29 @@ void CollectCPUUsage(void) {
 void CollectStackUsage(void){
     // Must match the sizes you passed to xTaskCreate
     stackInput.allocated   = 67;
-    stackSnake.allocated   = 29;
+    stackSnake.allocated   = 64;
     stackRender.allocated  = 350;
     stackMonitor.allocated = 73;
+    stackTimer.allocated   = configTIMER_TASK_STACK_DEPTH;
 
     stackInput.highWater   = uxTaskGetStackHighWaterMark(hInput);
     stackSnake.highWater   = uxTaskGetStackHighWaterMark(hSnake);
     stackRender.highWater  = uxTaskGetStackHighWaterMark(hRender);
     stackMonitor.highWater = uxTaskGetStackHighWaterMark(hMonitor);
+    stackTimer.highWater   = uxTaskGetStackHighWaterMark(xTimerGetTimerDaemonTaskHandle());
 
     stackInput.used   = stackInput.allocated   - stackInput.highWater;
     stackSnake.used   = stackSnake.allocated   - stackSnake.highWater;
     stackRender.used  = stackRender.allocated  - stackRender.highWater;
     stackMonitor.used = stackMonitor.allocated - stackMonitor.highWater;
+    stackTimer.used   = stackTimer.allocated   - stackTimer.highWater;
 }
 
 // Reads joystick/buttons and updates gameState
 static void vInputTask(void *pvParameters)
 {
     (void)pvParameters;
-    uint8_t lastDetectedDirection;
+    uint8_t lastDetectedDirection = RIGHT;
     uint8_t newDirection = RIGHT;
     
     for (;;) {
@@ -348,15 +432,19 @@ static void vInputTask(void *pvParameters)
 
         
         
-        // Toggle pause on S1
+        // Toggle pause on S1, or replay the game that just ended
         if (btnPause.wasPressed()) {
-            Buzzer_Post(250,50);
-            gameState.isRunning = !gameState.isRunning;
+            Buzzer_Play(kSoundPause);
+            if (gameState.snekIsKil || gameState.snekHasWon) {
+                gameState.needsReplay = true;
+            } else {
+                gameState.isRunning = !gameState.isRunning;
+            }
         }
 
         // Request reset on S2
         if (btnReset.wasPressed()) {
-            Buzzer_Post(500,50);
+            Buzzer_Play(kSoundReset);
             lastDetectedDirection = RIGHT;
             newDirection = RIGHT;
             gameState.needsReset = true;
@@ -388,21 +476,33 @@ static void vInputTask(void *pvParameters)
                 break;
         }
         
-        if((newDirection != lastDetectedDirection) && (gameState.isRunning)) {
-            if(
-                ((newDirection == UP   ) && (lastDetectedDirection != DOWN )) ||
-                ((newDirection == DOWN ) && (lastDetectedDirection != UP   )) ||
-                ((newDirection == LEFT ) && (lastDetectedDirection != RIGHT)) ||
-                ((newDirection == RIGHT) && (lastDetectedDirection != LEFT ))
-            ) {
-                if (xQueueSend(xQueueDirections, &newDirection, 0) == pdPASS) {
-                    xSemaphoreGive(xSemJoystickInput);
-                    lastDetectedDirection = newDirection;
-                }
+        // Only stick changes are queued. The snek task rejects reversals
+        // against the engine's heading, which the autopilot, a rewind or a
+        // replay may have moved since the stick last did, so follow it
+        // whenever the stick is not steering.
+        if (!gameState.isRunning || gameState.isReplaying || gameState.autopilot) {
+            lastDetectedDirection = gameState.currentDirection;
+            newDirection = lastDetectedDirection;
+        } else if (newDirection != lastDetectedDirection) {
+            if (xQueueSend(xQueueDirections, &newDirection, 0) == pdPASS) {
+                gInputQueuedUs = micros();
+                xSemaphoreGive(xSemJoystickInput);
+                lastDetectedDirection = newDirection;
             }
         }
     
-        if(gJoystick.wasPressed()) debugMode = !debugMode;
+        // Stick push rewinds from the death screen, toggles the autopilot
+        // while paused, otherwise toggles debug
+        if(gJoystick.wasPressed()) {
+            if (gameState.snekIsKil && !gameState.isReplaying) {
+                gameState.needsRewind = true;
+            } else if (!gameState.isRunning && !gameState.snekHasWon) {
+                Buzzer_Play(kSoundAutopilot);
+                gameState.autopilot = !gameState.autopilot;
+            } else {
+                debugMode = !debugMode;
+            }
+        }
 
         vTaskDelay(pdMS_TO_TICKS(INPUT_TICK_MS));
     }
@@ -412,78 +512,149 @@ static void vInputTask(void *pvParameters)
 // Advances the snek periodically
 static void vsnekTask(void *pvParameters) {
     (void)pvParameters;
-    ResetGame();
+    ResetGame(micros());   // seed from the free-running timer
     TickType_t last = xTaskGetTickCount();
     Direction bufferDirection = RIGHT;
-    
+    uint8_t periodLevel = gameState.speedLevel;   // level the last delay ran at
+
     for(;;){
-        //  Timing_PeriodTick();        // Measure period between task executions
-        //  Timing_ExecutionStart();    // Start measuring execution times
+        bool newFrame = false;
+        uint32_t inputUs = 0;
 
         if(gameState.needsReset) {
-            ResetGame();
+            Timing_PeriodBreak();
+            ResetGame(micros());
+        } else if(gameState.needsReplay) {
+            Timing_PeriodBreak();
+            StartReplay();
+        } else if(gameState.needsRewind) {
+            Timing_PeriodBreak();
+            uint32_t t0 = micros();
+            if (RewindGame()) newFrame = true;
+            uint32_t dt = micros() - t0;
+            if (dt > gRewindMaxUs) gRewindMaxUs = dt;
         }
 
         while(xSemaphoreTake(xSemJoystickInput, 0) == pdPASS) {
             if (xQueueReceive(xQueueDirections, &bufferDirection, 0) == pdPASS) {
+                if (gameState.isReplaying) continue;    // playback owns the direction
+                if (gGame.turnsBack(bufferDirection)) continue;   // would die at once
                 gameState.currentDirection = bufferDirection;
+                InputLog_Record(&gInputLog, gGame.ticks(), bufferDirection);
+                inputUs = gInputQueuedUs;
         }
 }
+        // The engine ignores steps once the snek has died or won
         if(gameState.isRunning) {
-            movesnek();
-            
-            if(IsHeadOnSnek()) gameState.snekIsKil = true;
-
-            if (HasEatenFruit()) {
-                score++;
-                snekLength++;
-                Buzzer_Post(250, 15);
-                Buzzer_Post(750, 30);
-                Buzzer_Post(250, 15);
-                SpawnFruit();//consume
+            Timing_PeriodTick(periodLevel);     // Measure period between steps
+
+            if (gameState.isReplaying) {
+                gameState.currentDirection = InputLog_PlayerDirection(&gReplay, gGame.ticks());
+            } else if (gameState.autopilot) {
+                // Logged like joystick input so autopilot games replay too
+                Direction d = gAutopilot.decide(gGame);
+                if (d != gameState.currentDirection) {
+                    gameState.currentDirection = d;
+                    InputLog_Record(&gInputLog, gGame.ticks(), d);
+                }
             }
 
-            if(score > highScore) highScore = score;  
-            renderMailbox++;
+            uint8_t events = gGame.step((Direction)gameState.currentDirection);
+
+            uint32_t t0 = micros();
+            gRewind.record(gGame, (Direction)gameState.currentDirection, events);
+            uint32_t dt = micros() - t0;
+            if (dt > gRewindRecordMaxUs) gRewindRecordMaxUs = dt;
+
+            // Close the log so this game can be replayed; playback keeps it
+            if ((events & (EVENT_DIED | EVENT_WON)) && !gameState.isReplaying) {
+                InputLog_End(&gInputLog, gGame.ticks(), gGame.score(), events);
+            }
+
+            if (events & EVENT_DIED) gameState.snekIsKil = true;
+
+            if (events & EVENT_ATE) {
+                Buzzer_Play(kSoundFruit);
+            }
+
+            if (events & EVENT_WON) gameState.snekHasWon = true;
+
+            if(gGame.score() > highScore) highScore = gGame.score();  
+            gameState.speedLevel = SpeedLevel(gGame.score());
+            newFrame = true;
         }
 
-        if (gameState.snekIsKil) {
+        if (gameState.snekIsKil || gameState.snekHasWon) {
             gameState.isRunning = false;
         }
+        if (!gameState.isRunning) Timing_PeriodBreak();
+
+        // Render runs at a higher priority, so it starts on this state now.
+        // It draws from the published copy, not gGame.
+        if (newFrame) {
+            PublishFrame();
+            if (inputUs != 0u) frame_input_us = inputUs;
+            gStepDoneUs = micros();
+            xTaskNotifyGive(hRender);
+        }
 
-        vTaskDelayUntil(&last,pdMS_TO_TICKS(69));
+        periodLevel = gameState.speedLevel;
+        vTaskDelayUntil(&last,pdMS_TO_TICKS(kSnekPeriodMs[periodLevel]));
     }
 }
 
-// Renders current frame to LCD (guarded by mutex)
+// Renders a frame (guarded by mutex) each time the snek task publishes a
+// new state. Notifications that arrive while drawing fold into one frame.
 static void vRenderTask(void *pvParameters)
 {
     (void)pvParameters;
     LCD_Init();
-    TickType_t last = xTaskGetTickCount();
     
     for(;;) {
-        if (renderMailbox != 0){
-            Timing_PeriodTick();        // Measure period between task executions
-            Timing_ExecutionStart();    // Start measuring execution times
-
-            // take mutex before drawing
-            xSemaphoreTake(xMutexLCD, portMAX_DELAY);
-            if (gameState.snekIsKil){
-                DrawKilScren();
-                
-            } else{
-                DrawGame(&gameState);
-            }
-            // let it roam free
-            xSemaphoreGive(xMutexLCD);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        TickType_t frameStart = xTaskGetTickCount();
+
+        Timing_ExecutionStart();    // Start measuring execution times
+
+        // Newest published state; gGame may be mid-step
+        const RenderFrame* frame = gFrames.acquire();
 
-            gFrameCount++;
-            renderMailbox = 0;
-            Timing_ExecutionEnd();      // End measuring execution time
+        // take mutex before drawing
+        xSemaphoreTake(xMutexLCD, portMAX_DELAY);
+        if (frame->snekIsKil){
+            DrawKilScren(frame);
+            
+        } else if (frame->snekHasWon){
+            DrawWinScren(frame);
+        } else{
+            DrawGame(frame);
+        }
+        // let it roam free
+        xSemaphoreGive(xMutexLCD);
+
+        uint32_t latency = micros() - gStepDoneUs;
+        gFrameLatencyUs = latency;
+        if (latency > latency_max_us) latency_max_us = latency;
+        latency_sum_us += latency;
+        latency_count++;
+
+        uint32_t inputUs = frame_input_us;
+        if (inputUs != 0u) {
+            frame_input_us = 0u;
+            uint32_t inputLatency = micros() - inputUs;
+            if (inputLatency > input_latency_max_us) input_latency_max_us = inputLatency;
+            input_latency_sum_us += inputLatency;
+            input_latency_count++;
         }
 
-        vTaskDelayUntil(&last,pdMS_TO_TICKS(38));
+        gFrameCount++;
+        Timing_ExecutionEnd();      // End measuring execution time
+
+        // Optional cap: keep at least RENDER_MIN_PERIOD_MS between frames
+        TickType_t spent = xTaskGetTickCount() - frameStart;
+        if (RENDER_MIN_PERIOD_MS > 0U && spent < pdMS_TO_TICKS(RENDER_MIN_PERIOD_MS)) {
+            vTaskDelay(pdMS_TO_TICKS(RENDER_MIN_PERIOD_MS) - spent);
+        }
     }
 }
 
@@ -501,35 +672,50 @@ void MonitorTask(void *pvParameters) {
         gCurrentFPS = gFrameCount>>1;
         gFrameCount = 0;  // Reset counter for next second
 
-        // Copy stats from measurement functions
-        uint32_t p_count = period_count;
-        uint64_t p_sum   = sum_period_us;
-        int32_t  jit     = last_jitter_us;
+        // Copy stats from measurement functions. Levels that ran in this
+        // window get a fresh snapshot, the others keep their last one.
+        for (uint8_t i = 0; i < SPEED_LEVELS; i++) {
+            if (period_count[i] == 0u) continue;
+            gLevelTiming[i].avgPeriodUs  = (uint32_t)(sum_period_us[i] / period_count[i]);
+            gLevelTiming[i].minPeriodUs  = min_period_us[i];
+            gLevelTiming[i].maxPeriodUs  = max_period_us[i];
+            gLevelTiming[i].maxJitterUs  = max_jitter_us[i];
+            gLevelTiming[i].lastJitterUs = last_jitter_us[i];
+            gLevelTiming[i].periods      = period_count[i];
+            Timing_ResetPeriodStats(i);
+        }
+        uint8_t level = gameState.speedLevel;
 
         uint32_t e_count = exec_count;
         uint64_t e_sum   = sum_exec_us;
         uint32_t e_max   = max_exec_us;
 
         // Compute averages
-        uint32_t avg_period_us = (p_count > 0u) ? (uint32_t)(p_sum / p_count) : 0u;
         uint32_t avg_exec_us   = (e_count > 0u) ? (uint32_t)(e_sum / e_count) : 0u;
 
         // Store snapshots for render task to display
-        gAvgPeriodUs        = avg_period_us;
-        gLastJitterSnapshot = jit;
+        gAvgPeriodUs        = gLevelTiming[level].avgPeriodUs;
+        gLastJitterSnapshot = gLevelTiming[level].lastJitterUs;
         gAvgExecUs          = avg_exec_us;
         gMaxExecUs          = e_max;
+        RenderProfile_Publish();
+        gStatsSeq++;
 
-        // Reset statistics window
-        min_period_us = 0xFFFFFFFFu;
-        max_period_us = 0u;
-        sum_period_us = 0u;
-        period_count  = 0u;
+        gFrameLatencyAvgUs  = latency_count ? (uint32_t)(latency_sum_us / latency_count) : 0u;
+        gFrameLatencyMaxUs  = latency_max_us;
+        gInputLatencyAvgUs  = input_latency_count ? (uint32_t)(input_latency_sum_us / input_latency_count) : 0u;
+        gInputLatencyMaxUs  = input_latency_max_us;
 
+        // Reset statistics window
         min_exec_us = 0xFFFFFFFFu;
         max_exec_us = 0u;
         sum_exec_us = 0u;
         exec_count  = 0u;
-        //renderMailbox++;
+        latency_max_us = 0u;
+        latency_sum_us = 0u;
+        latency_count  = 0u;
+        input_latency_max_us = 0u;
+        input_latency_sum_us = 0u;
+        input_latency_count  = 0u;
     }
 }
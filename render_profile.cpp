@@ -0,0 +1,71 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "render_profile.h"
+
+const uint32_t kProfileBucketUs[PROFILE_BUCKETS - 1] = {
+    50, 100, 250, 500, 1000, 2500, 5000, 10000, 20000
+};
+
+RenderProfile gRenderProfile;
+
+typedef struct {
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t sumUs;
+    uint32_t hist[PROFILE_BUCKETS];
+} PhaseWindow;
+
+typedef struct {
+    PhaseWindow phase[RENDER_PHASES];
+    uint32_t    frames;
+} ProfileWindow;
+
+// Two windows: the render task fills windows[active] while MonitorTask
+// reads out the other one. The render task has the higher priority, so
+// MonitorTask never switches windows in the middle of an Add.
+static ProfileWindow windows[2];
+static volatile uint8_t active = 0;
+
+static void resetWindow(ProfileWindow* w)
+{
+    memset(w, 0, sizeof(*w));
+    for (uint8_t p = 0; p < RENDER_PHASES; ++p) w->phase[p].minUs = 0xFFFFFFFFu;
+}
+
+void RenderProfile_Add(const uint32_t phaseUs[RENDER_PHASES])
+{
+    ProfileWindow* w = &windows[active];
+    if (w->frames == 0) resetWindow(w);
+    for (uint8_t p = 0; p < RENDER_PHASES; ++p) {
+        PhaseWindow* s = &w->phase[p];
+        uint32_t us = phaseUs[p];
+        if (us < s->minUs) s->minUs = us;
+        if (us > s->maxUs) s->maxUs = us;
+        s->sumUs += us;
+        uint8_t b = 0;
+        while (b < PROFILE_BUCKETS - 1 && us > kProfileBucketUs[b]) b++;
+        s->hist[b]++;
+    }
+    w->frames++;
+}
+
+void RenderProfile_Publish(void)
+{
+    uint8_t done = active;
+    active = (uint8_t)(done ^ 1u);
+    ProfileWindow* w = &windows[done];
+
+    // No frames (kil screen, paused): keep the last numbers
+    if (w->frames == 0) return;
+    for (uint8_t p = 0; p < RENDER_PHASES; ++p) {
+        const PhaseWindow* s = &w->phase[p];
+        PhaseStats* out = &gRenderProfile.phase[p];
+        out->minUs = s->minUs;
+        out->avgUs = (uint32_t)(s->sumUs / w->frames);
+        out->maxUs = s->maxUs;
+        memcpy(out->hist, s->hist, sizeof(out->hist));
+    }
+    gRenderProfile.frames = w->frames;
+    w->frames = 0;          // reset on its next Add
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+// Where DrawGame's time goes. The render task hands in the microseconds
+// each phase took, once per frame; MonitorTask closes the window every
+// 2 s and publishes it into gRenderProfile, which the debug overlay shows
+// and the debugger can read.
+enum {
+    PHASE_CLEAR,        // full-screen clear
+    PHASE_BODY,         // snek cells, old tail included, and the cell diff
+    PHASE_FRUIT,
+    PHASE_HUD,          // score, high score, chrono, mode
+    PHASE_OVERLAY,      // debug overlay: formatting and drawing
+    PHASE_FLUSH,        // sending to the panel
+    RENDER_PHASES
+};
+
+// Histogram buckets: a frame lands in the first bucket whose upper bound
+// (us, inclusive) it fits under; the last bucket takes the rest
+#define PROFILE_BUCKETS 10
+extern const uint32_t kProfileBucketUs[PROFILE_BUCKETS - 1];
+
+typedef struct {
+    uint32_t minUs;
+    uint32_t avgUs;
+    uint32_t maxUs;
+    uint32_t hist[PROFILE_BUCKETS];     // frames per bucket
+} PhaseStats;
+
+typedef struct {
+    PhaseStats phase[RENDER_PHASES];
+    uint32_t   frames;                  // frames behind the numbers
+} RenderProfile;
+
+extern RenderProfile gRenderProfile;    // last monitor window
+
+// Render task, once per DrawGame
+void RenderProfile_Add(const uint32_t phaseUs[RENDER_PHASES]);
+
+// MonitorTask: publish the window and start a new one
+void RenderProfile_Publish(void);
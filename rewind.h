@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game_engine.h"
+
+// Rewind buffer for the last few seconds of a game: a ring of keyframes
+// (GameEngine::Snapshot) taken every Interval ticks plus one delta byte per
+// tick. A delta is the direction the head moved, which fixes the new head
+// cell, and whether the tail stayed put (the snek ate). Rewinding restores
+// the newest keyframe at or before the target tick and re-steps the deltas
+// from there, checking the tail bit as it goes. No RTOS calls.
+//
+// With the defaults on a 16x16 board this is 4 x 80 + 128 bytes plus a few
+// words of bookkeeping, for 96 to 128 ticks of history (6.6 to 8.8 s at the
+// 69 ms snek period).
+
+#define REWIND_DIR_MASK 0x03u
+#define REWIND_GREW     0x04u   // tail kept this tick
+#define REWIND_NO_KEY   0xFFFFFFFFu
+
+template <class Cfg, uint8_t Keyframes = 4, uint16_t Interval = 32>
+class RewindBuffer {
+public:
+    typedef GameEngine<Cfg> Game;
+
+    static const uint32_t kDeltas = (uint32_t)Keyframes * Interval;
+
+    RewindBuffer() : newest(0) { clear(); }
+
+    void clear(void)
+    {
+        for (uint8_t k = 0; k < Keyframes; ++k) keyTick[k] = REWIND_NO_KEY;
+    }
+
+    // Forget all history and keyframe the game as it stands (call after reset)
+    void start(const Game& game)
+    {
+        clear();
+        newest = game.ticks();
+        saveKey(game);
+    }
+
+    // Call after every step with the direction passed to it and its events.
+    // A step on a finished game does not advance ticks and is not recorded.
+    void record(const Game& game, Direction dir, uint8_t events)
+    {
+        uint32_t t = game.ticks();            // step t-1 -> t just happened
+        if (t == newest) return;
+        deltas[(t - 1) % kDeltas] = (uint8_t)((dir & REWIND_DIR_MASK) |
+                                              ((events & EVENT_ATE) ? REWIND_GREW : 0));
+        newest = t;
+        if (t % Interval == 0) saveKey(game);
+    }
+
+    uint32_t newestTick(void) const { return newest; }
+
+    // Earliest tick rewindTo() can reach, or REWIND_NO_KEY before start()
+    uint32_t oldestTick(void) const
+    {
+        uint32_t oldest = REWIND_NO_KEY;
+        for (uint8_t k = 0; k < Keyframes; ++k) {
+            if (usable(k) && keyTick[k] < oldest) oldest = keyTick[k];
+        }
+        return oldest;
+    }
+
+    // Put game back to how it was after `tick` steps and drop the history
+    // past it. Returns false with the game untouched if tick is out of
+    // range. A re-stepped tick that disagrees with its delta means the
+    // buffer was not fed this game; that also returns false, leaving the
+    // game at the keyframe.
+    bool rewindTo(Game* game, uint32_t tick)
+    {
+        if (tick > newest) return false;
+
+        // Newest usable keyframe at or before tick
+        int8_t best = -1;
+        for (uint8_t k = 0; k < Keyframes; ++k) {
+            if (usable(k) && keyTick[k] <= tick &&
+                (best < 0 || keyTick[k] > keyTick[best])) {
+                best = (int8_t)k;
+            }
+        }
+        if (best < 0) return false;
+
+        game->restore(&keys[best]);
+        for (uint32_t t = keyTick[best]; t < tick; ++t) {
+            uint8_t d  = deltas[t % kDeltas];
+            uint8_t ev = game->step((Direction)(d & REWIND_DIR_MASK));
+            if (((ev & EVENT_ATE) != 0) != ((d & REWIND_GREW) != 0)) {
+                game->restore(&keys[best]);
+                newest = keyTick[best];
+                return false;
+            }
+        }
+        newest = tick;
+        return true;
+    }
+
+private:
+    void saveKey(const Game& game)
+    {
+        uint8_t k = (uint8_t)((game.ticks() / Interval) % Keyframes);
+        game.save(&keys[k]);
+        keyTick[k] = game.ticks();
+    }
+
+    // Keyframe k is from this timeline and every delta after it is still held
+    bool usable(uint8_t k) const
+    {
+        return keyTick[k] != REWIND_NO_KEY && keyTick[k] <= newest &&
+               newest - keyTick[k] <= kDeltas;
+    }
+
+    typename Game::Snapshot keys[Keyframes];
+    uint32_t keyTick[Keyframes];         // tick each slot holds, REWIND_NO_KEY if empty
+    uint8_t  deltas[kDeltas];            // indexed by step number % kDeltas
+    uint32_t newest;                     // ticks recorded so far
+};
@@ -0,0 +1,222 @@
+// Generated by host/gen_screens; do not edit. Rerun it after changing
+// DrawScreenArt() or the fonts it uses.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "screen_art.h"
+
+static const uint8_t kKilData[] = {
+    0x00, 0x1C, 0x06, 0x45, 0x03, 0x41, 0x04, 0x45, 0x07, 0x45, 0x03, 0x4F,
+    0x05, 0x46, 0x07, 0x45, 0x38, 0x42, 0x04, 0x41, 0x02, 0x41, 0x06, 0x43,
+    0x08, 0x43, 0x06, 0x42, 0x09, 0x43, 0x06, 0x42, 0x0A, 0x42, 0x39, 0x42,
+    0x06, 0x43, 0x06, 0x41, 0x01, 0x42, 0x08, 0x41, 0x07, 0x42, 0x0A, 0x42,
+    0x06, 0x42, 0x0A, 0x41, 0x39, 0x42, 0x08, 0x42, 0x06, 0x41, 0x01, 0x42,
+    0x08, 0x41, 0x07, 0x42, 0x0B, 0x41, 0x06, 0x42, 0x09, 0x41, 0x3A, 0x42,
+    0x09, 0x41, 0x06, 0x41, 0x02, 0x42, 0x07, 0x41, 0x07, 0x42, 0x0B, 0x41,
+    0x06, 0x42, 0x08, 0x41, 0x3B, 0x42, 0x09, 0x41, 0x06, 0x41, 0x02, 0x42,
+    0x07, 0x41, 0x07, 0x42, 0x0B, 0x41, 0x06, 0x42, 0x07, 0x41, 0x3C, 0x42,
+    0x09, 0x41, 0x06, 0x41, 0x03, 0x42, 0x06, 0x41, 0x07, 0x42, 0x06, 0x41,
+    0x04, 0x41, 0x06, 0x42, 0x06, 0x41, 0x3D, 0x43, 0x0F, 0x41, 0x03, 0x43,
+    0x05, 0x41, 0x07, 0x42, 0x06, 0x41, 0x0B, 0x42, 0x05, 0x41, 0x3F, 0x44,
+    0x0D, 0x41, 0x04, 0x42, 0x05, 0x41, 0x07, 0x42, 0x06, 0x41, 0x0B, 0x42,
+    0x04, 0x41, 0x00, 0x41, 0x00, 0x46, 0x0A, 0x41, 0x05, 0x42, 0x04, 0x41,
+    0x07, 0x42, 0x05, 0x42, 0x0B, 0x42, 0x03, 0x43, 0x00, 0x42, 0x00, 0x47,
+    0x07, 0x41, 0x05, 0x42, 0x04, 0x41, 0x07, 0x49, 0x0B, 0x42, 0x02, 0x41,
+    0x01, 0x43, 0x00, 0x44, 0x00, 0x45, 0x06, 0x41, 0x06, 0x42, 0x03, 0x41,
+    0x07, 0x42, 0x05, 0x42, 0x0B, 0x42, 0x01, 0x41, 0x03, 0x42, 0x00, 0x47,
+    0x00, 0x42, 0x06, 0x41, 0x06, 0x42, 0x03, 0x41, 0x07, 0x42, 0x06, 0x41,
+    0x0B, 0x43, 0x05, 0x42, 0x00, 0x46, 0x00, 0x43, 0x05, 0x41, 0x07, 0x42,
+    0x02, 0x41, 0x07, 0x42, 0x06, 0x41, 0x0B, 0x42, 0x06, 0x43, 0x3B, 0x41,
+    0x0A, 0x42, 0x05, 0x41, 0x07, 0x43, 0x01, 0x41, 0x07, 0x42, 0x0C, 0x41,
+    0x05, 0x42, 0x07, 0x42, 0x3B, 0x41, 0x0A, 0x42, 0x05, 0x41, 0x08, 0x42,
+    0x01, 0x41, 0x07, 0x42, 0x0C, 0x41, 0x05, 0x42, 0x08, 0x42, 0x3A, 0x41,
+    0x0A, 0x42, 0x05, 0x41, 0x09, 0x43, 0x07, 0x42, 0x0B, 0x41, 0x06, 0x42,
+    0x08, 0x43, 0x39, 0x42, 0x09, 0x42, 0x05, 0x41, 0x09, 0x43, 0x07, 0x42,
+    0x0B, 0x41, 0x06, 0x42, 0x09, 0x42, 0x39, 0x43, 0x07, 0x42, 0x06, 0x41,
+    0x0A, 0x42, 0x07, 0x42, 0x0B, 0x41, 0x06, 0x42, 0x0A, 0x42, 0x38, 0x41,
+    0x02, 0x41, 0x05, 0x42, 0x06, 0x43, 0x09, 0x42, 0x07, 0x42, 0x09, 0x43,
+    0x06, 0x42, 0x0A, 0x43, 0x37, 0x41, 0x03, 0x46, 0x06, 0x45, 0x09, 0x41,
+    0x05, 0x50, 0x04, 0x46, 0x07, 0x46, 0x00, 0x4F, 0x02, 0x48, 0x06, 0x45,
+    0x03, 0x41, 0x00, 0x6C, 0x00, 0x42, 0x08, 0x42, 0x04, 0x41, 0x02, 0x41,
+    0x00, 0x6C, 0x00, 0x42, 0x07, 0x42, 0x06, 0x43, 0x00, 0x6C, 0x00, 0x42,
+    0x06, 0x42, 0x08, 0x42, 0x00, 0x6C, 0x00, 0x42, 0x06, 0x42, 0x09, 0x41,
+    0x00, 0x6C, 0x00, 0x42, 0x06, 0x42, 0x09, 0x41, 0x00, 0x6C, 0x00, 0x42,
+    0x06, 0x42, 0x09, 0x41, 0x00, 0x6C, 0x00, 0x42, 0x06, 0x43, 0x00, 0x75,
+    0x00, 0x42, 0x07, 0x44, 0x00, 0x73, 0x00, 0x42, 0x08, 0x46, 0x00, 0x70,
+    0x00, 0x42, 0x0A, 0x47, 0x00, 0x6D, 0x00, 0x42, 0x0D, 0x45, 0x00, 0x6C,
+    0x00, 0x42, 0x10, 0x42, 0x00, 0x6C, 0x00, 0x42, 0x10, 0x43, 0x00, 0x6B,
+    0x00, 0x42, 0x06, 0x41, 0x0A, 0x42, 0x00, 0x6B, 0x00, 0x42, 0x06, 0x41,
+    0x0A, 0x42, 0x00, 0x6B, 0x00, 0x42, 0x06, 0x41, 0x0A, 0x42, 0x00, 0x6B,
+    0x00, 0x42, 0x06, 0x42, 0x09, 0x42, 0x00, 0x6B, 0x00, 0x42, 0x06, 0x43,
+    0x07, 0x42, 0x00, 0x6C, 0x00, 0x42, 0x06, 0x41, 0x02, 0x41, 0x05, 0x42,
+    0x00, 0x6A, 0x00, 0x48, 0x03, 0x41, 0x03, 0x46, 0x00, 0x5F, 0x02, 0x46,
+    0x07, 0x45, 0x04, 0x48, 0x03, 0x47, 0x00, 0x5A, 0x00, 0x42, 0x0A, 0x42,
+    0x09, 0x42, 0x08, 0x42, 0x00, 0x5D, 0x00, 0x42, 0x0A, 0x41, 0x0A, 0x42,
+    0x08, 0x42, 0x00, 0x5D, 0x00, 0x42, 0x09, 0x41, 0x0B, 0x42, 0x08, 0x42,
+    0x00, 0x5D, 0x00, 0x42, 0x08, 0x41, 0x0C, 0x42, 0x08, 0x42, 0x00, 0x5D,
+    0x00, 0x42, 0x07, 0x41, 0x0D, 0x42, 0x08, 0x42, 0x00, 0x5D, 0x00, 0x42,
+    0x06, 0x41, 0x0E, 0x42, 0x08, 0x42, 0x00, 0x5D, 0x00, 0x42, 0x05, 0x41,
+    0x0F, 0x42, 0x08, 0x42, 0x00, 0x5D, 0x00, 0x42, 0x04, 0x41, 0x10, 0x42,
+    0x08, 0x42, 0x00, 0x5D, 0x00, 0x42, 0x03, 0x43, 0x0F, 0x42, 0x08, 0x42,
+    0x00, 0x5D, 0x00, 0x42, 0x02, 0x41, 0x01, 0x43, 0x0E, 0x42, 0x08, 0x42,
+    0x00, 0x5D, 0x00, 0x42, 0x01, 0x41, 0x03, 0x42, 0x0E, 0x42, 0x08, 0x42,
+    0x00, 0x5D, 0x00, 0x43, 0x05, 0x42, 0x0D, 0x42, 0x08, 0x42, 0x00, 0x5D,
+    0x00, 0x42, 0x06, 0x43, 0x0C, 0x42, 0x08, 0x42, 0x00, 0x5D, 0x00, 0x42,
+    0x07, 0x42, 0x0C, 0x42, 0x08, 0x42, 0x09, 0x41, 0x00, 0x53, 0x00, 0x42,
+    0x08, 0x42, 0x0B, 0x42, 0x08, 0x42, 0x09, 0x41, 0x00, 0x53, 0x00, 0x42,
+    0x08, 0x43, 0x0A, 0x42, 0x08, 0x42, 0x09, 0x41, 0x00, 0x53, 0x00, 0x42,
+    0x09, 0x42, 0x0A, 0x42, 0x08, 0x42, 0x09, 0x41, 0x00, 0x53, 0x00, 0x42,
+    0x0A, 0x42, 0x09, 0x42, 0x08, 0x42, 0x08, 0x42, 0x00, 0x53, 0x00, 0x42,
+    0x0A, 0x43, 0x08, 0x42, 0x08, 0x42, 0x07, 0x43, 0x00, 0x51, 0x00, 0x46,
+    0x07, 0x46, 0x03, 0x48, 0x03, 0x4E, 0x00, 0xAA, 0x16,
+};
+
+static const uint8_t kWinData[] = {
+    0x00, 0x1C, 0x06, 0x45, 0x03, 0x41, 0x04, 0x45, 0x07, 0x45, 0x03, 0x4F,
+    0x05, 0x46, 0x07, 0x45, 0x38, 0x42, 0x04, 0x41, 0x02, 0x41, 0x06, 0x43,
+    0x08, 0x43, 0x06, 0x42, 0x09, 0x43, 0x06, 0x42, 0x0A, 0x42, 0x39, 0x42,
+    0x06, 0x43, 0x06, 0x41, 0x01, 0x42, 0x08, 0x41, 0x07, 0x42, 0x0A, 0x42,
+    0x06, 0x42, 0x0A, 0x41, 0x39, 0x42, 0x08, 0x42, 0x06, 0x41, 0x01, 0x42,
+    0x08, 0x41, 0x07, 0x42, 0x0B, 0x41, 0x06, 0x42, 0x09, 0x41, 0x3A, 0x42,
+    0x09, 0x41, 0x06, 0x41, 0x02, 0x42, 0x07, 0x41, 0x07, 0x42, 0x0B, 0x41,
+    0x06, 0x42, 0x08, 0x41, 0x3B, 0x42, 0x09, 0x41, 0x06, 0x41, 0x02, 0x42,
+    0x07, 0x41, 0x07, 0x42, 0x0B, 0x41, 0x06, 0x42, 0x07, 0x41, 0x3C, 0x42,
+    0x09, 0x41, 0x06, 0x41, 0x03, 0x42, 0x06, 0x41, 0x07, 0x42, 0x06, 0x41,
+    0x04, 0x41, 0x06, 0x42, 0x06, 0x41, 0x3D, 0x43, 0x0F, 0x41, 0x03, 0x43,
+    0x05, 0x41, 0x07, 0x42, 0x06, 0x41, 0x0B, 0x42, 0x05, 0x41, 0x3F, 0x44,
+    0x0D, 0x41, 0x04, 0x42, 0x05, 0x41, 0x07, 0x42, 0x06, 0x41, 0x0B, 0x42,
+    0x04, 0x41, 0x00, 0x41, 0x00, 0x46, 0x0A, 0x41, 0x05, 0x42, 0x04, 0x41,
+    0x07, 0x42, 0x05, 0x42, 0x0B, 0x42, 0x03, 0x43, 0x00, 0x42, 0x00, 0x47,
+    0x07, 0x41, 0x05, 0x42, 0x04, 0x41, 0x07, 0x49, 0x0B, 0x42, 0x02, 0x41,
+    0x01, 0x43, 0x00, 0x44, 0x00, 0x45, 0x06, 0x41, 0x06, 0x42, 0x03, 0x41,
+    0x07, 0x42, 0x05, 0x42, 0x0B, 0x42, 0x01, 0x41, 0x03, 0x42, 0x00, 0x47,
+    0x00, 0x42, 0x06, 0x41, 0x06, 0x42, 0x03, 0x41, 0x07, 0x42, 0x06, 0x41,
+    0x0B, 0x43, 0x05, 0x42, 0x00, 0x46, 0x00, 0x43, 0x05, 0x41, 0x07, 0x42,
+    0x02, 0x41, 0x07, 0x42, 0x06, 0x41, 0x0B, 0x42, 0x06, 0x43, 0x3B, 0x41,
+    0x0A, 0x42, 0x05, 0x41, 0x07, 0x43, 0x01, 0x41, 0x07, 0x42, 0x0C, 0x41,
+    0x05, 0x42, 0x07, 0x42, 0x3B, 0x41, 0x0A, 0x42, 0x05, 0x41, 0x08, 0x42,
+    0x01, 0x41, 0x07, 0x42, 0x0C, 0x41, 0x05, 0x42, 0x08, 0x42, 0x3A, 0x41,
+    0x0A, 0x42, 0x05, 0x41, 0x09, 0x43, 0x07, 0x42, 0x0B, 0x41, 0x06, 0x42,
+    0x08, 0x43, 0x39, 0x42, 0x09, 0x42, 0x05, 0x41, 0x09, 0x43, 0x07, 0x42,
+    0x0B, 0x41, 0x06, 0x42, 0x09, 0x42, 0x39, 0x43, 0x07, 0x42, 0x06, 0x41,
+    0x0A, 0x42, 0x07, 0x42, 0x0B, 0x41, 0x06, 0x42, 0x0A, 0x42, 0x38, 0x41,
+    0x02, 0x41, 0x05, 0x42, 0x06, 0x43, 0x09, 0x42, 0x07, 0x42, 0x09, 0x43,
+    0x06, 0x42, 0x0A, 0x43, 0x37, 0x41, 0x03, 0x46, 0x06, 0x45, 0x09, 0x41,
+    0x05, 0x50, 0x04, 0x46, 0x07, 0x46, 0x00, 0x4F, 0x02, 0x48, 0x06, 0x45,
+    0x03, 0x41, 0x00, 0x6C, 0x00, 0x42, 0x08, 0x42, 0x04, 0x41, 0x02, 0x41,
+    0x00, 0x6C, 0x00, 0x42, 0x07, 0x42, 0x06, 0x43, 0x00, 0x6C, 0x00, 0x42,
+    0x06, 0x42, 0x08, 0x42, 0x00, 0x6C, 0x00, 0x42, 0x06, 0x42, 0x09, 0x41,
+    0x00, 0x6C, 0x00, 0x42, 0x06, 0x42, 0x09, 0x41, 0x00, 0x6C, 0x00, 0x42,
+    0x06, 0x42, 0x09, 0x41, 0x00, 0x6C, 0x00, 0x42, 0x06, 0x43, 0x00, 0x75,
+    0x00, 0x42, 0x07, 0x44, 0x00, 0x73, 0x00, 0x42, 0x08, 0x46, 0x00, 0x70,
+    0x00, 0x42, 0x0A, 0x47, 0x00, 0x6D, 0x00, 0x42, 0x0D, 0x45, 0x00, 0x6C,
+    0x00, 0x42, 0x10, 0x42, 0x00, 0x6C, 0x00, 0x42, 0x10, 0x43, 0x00, 0x6B,
+    0x00, 0x42, 0x06, 0x41, 0x0A, 0x42, 0x00, 0x6B, 0x00, 0x42, 0x06, 0x41,
+    0x0A, 0x42, 0x00, 0x6B, 0x00, 0x42, 0x06, 0x41, 0x0A, 0x42, 0x00, 0x6B,
+    0x00, 0x42, 0x06, 0x42, 0x09, 0x42, 0x00, 0x6B, 0x00, 0x42, 0x06, 0x43,
+    0x07, 0x42, 0x00, 0x6C, 0x00, 0x42, 0x06, 0x41, 0x02, 0x41, 0x05, 0x42,
+    0x00, 0x6A, 0x00, 0x48, 0x03, 0x41, 0x03, 0x46, 0x00, 0x59, 0x02, 0x46,
+    0x05, 0x46, 0x06, 0x45, 0x03, 0x48, 0x03, 0x45, 0x07, 0x45, 0x00, 0x47,
+    0x00, 0x42, 0x09, 0x42, 0x0A, 0x41, 0x08, 0x42, 0x08, 0x43, 0x08, 0x43,
+    0x00, 0x48, 0x00, 0x42, 0x09, 0x42, 0x0A, 0x41, 0x08, 0x42, 0x08, 0x41,
+    0x01, 0x42, 0x08, 0x41, 0x00, 0x4A, 0x00, 0x42, 0x09, 0x42, 0x08, 0x41,
+    0x09, 0x42, 0x08, 0x41, 0x01, 0x42, 0x08, 0x41, 0x00, 0x4A, 0x00, 0x42,
+    0x08, 0x43, 0x08, 0x41, 0x09, 0x42, 0x08, 0x41, 0x02, 0x42, 0x07, 0x41,
+    0x00, 0x4A, 0x00, 0x42, 0x08, 0x43, 0x08, 0x41, 0x09, 0x42, 0x08, 0x41,
+    0x02, 0x42, 0x07, 0x41, 0x00, 0x4B, 0x00, 0x42, 0x06, 0x41, 0x02, 0x42,
+    0x06, 0x41, 0x0A, 0x42, 0x08, 0x41, 0x03, 0x42, 0x06, 0x41, 0x00, 0x4B,
+    0x00, 0x42, 0x06, 0x41, 0x02, 0x42, 0x06, 0x41, 0x0A, 0x42, 0x08, 0x41,
+    0x03, 0x43, 0x05, 0x41, 0x00, 0x4B, 0x00, 0x42, 0x06, 0x41, 0x02, 0x42,
+    0x06, 0x41, 0x0A, 0x42, 0x08, 0x41, 0x04, 0x42, 0x05, 0x41, 0x00, 0x4C,
+    0x00, 0x42, 0x04, 0x41, 0x04, 0x42, 0x04, 0x41, 0x0B, 0x42, 0x08, 0x41,
+    0x05, 0x42, 0x04, 0x41, 0x00, 0x4C, 0x00, 0x42, 0x04, 0x41, 0x04, 0x42,
+    0x04, 0x41, 0x0B, 0x42, 0x08, 0x41, 0x05, 0x42, 0x04, 0x41, 0x00, 0x4C,
+    0x00, 0x42, 0x04, 0x41, 0x04, 0x42, 0x04, 0x41, 0x0B, 0x42, 0x08, 0x41,
+    0x06, 0x42, 0x03, 0x41, 0x00, 0x4C, 0x00, 0x43, 0x02, 0x41, 0x06, 0x42,
+    0x02, 0x41, 0x0C, 0x42, 0x08, 0x41, 0x06, 0x42, 0x03, 0x41, 0x00, 0x4D,
+    0x00, 0x42, 0x02, 0x41, 0x06, 0x42, 0x02, 0x41, 0x0C, 0x42, 0x08, 0x41,
+    0x07, 0x42, 0x02, 0x41, 0x00, 0x4D, 0x00, 0x42, 0x02, 0x41, 0x06, 0x42,
+    0x02, 0x41, 0x0C, 0x42, 0x08, 0x41, 0x07, 0x43, 0x01, 0x41, 0x00, 0x4D,
+    0x00, 0x44, 0x07, 0x43, 0x01, 0x41, 0x0C, 0x42, 0x08, 0x41, 0x08, 0x42,
+    0x01, 0x41, 0x00, 0x4E, 0x00, 0x43, 0x08, 0x43, 0x0D, 0x42, 0x08, 0x41,
+    0x09, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x08, 0x43, 0x0D, 0x42, 0x08, 0x41,
+    0x09, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x08, 0x43, 0x0D, 0x42, 0x08, 0x41,
+    0x0A, 0x42, 0x00, 0x4F, 0x00, 0x41, 0x0A, 0x41, 0x0E, 0x42, 0x07, 0x43,
+    0x09, 0x42, 0x00, 0x4F, 0x00, 0x41, 0x0A, 0x41, 0x0B, 0x48, 0x03, 0x45,
+    0x09, 0x41, 0x00, 0xA6, 0x16,
+};
+
+static const uint8_t kOverflowData[] = {
+    0x00, 0xA3, 0x09, 0x48, 0x02, 0x46, 0x06, 0x46, 0x09, 0x43, 0x04, 0x46,
+    0x00, 0x4F, 0x00, 0x41, 0x06, 0x41, 0x02, 0x41, 0x04, 0x42, 0x05, 0x41,
+    0x04, 0x42, 0x05, 0x42, 0x03, 0x42, 0x03, 0x41, 0x04, 0x42, 0x00, 0x4D,
+    0x00, 0x41, 0x06, 0x41, 0x02, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41,
+    0x05, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x00, 0x4D, 0x00, 0x41,
+    0x03, 0x41, 0x05, 0x41, 0x04, 0x42, 0x05, 0x41, 0x04, 0x42, 0x04, 0x41,
+    0x07, 0x41, 0x02, 0x41, 0x04, 0x42, 0x00, 0x4D, 0x00, 0x45, 0x05, 0x45,
+    0x07, 0x45, 0x06, 0x41, 0x07, 0x41, 0x02, 0x45, 0x06, 0x41, 0x00, 0x48,
+    0x00, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x42, 0x06, 0x41, 0x03, 0x42,
+    0x05, 0x41, 0x07, 0x41, 0x02, 0x41, 0x03, 0x42, 0x00, 0x4E, 0x00, 0x41,
+    0x03, 0x41, 0x05, 0x41, 0x04, 0x41, 0x06, 0x41, 0x04, 0x41, 0x05, 0x41,
+    0x07, 0x41, 0x02, 0x41, 0x04, 0x41, 0x00, 0x4E, 0x00, 0x41, 0x06, 0x41,
+    0x02, 0x41, 0x04, 0x42, 0x05, 0x41, 0x04, 0x42, 0x04, 0x41, 0x07, 0x41,
+    0x02, 0x41, 0x04, 0x42, 0x00, 0x4D, 0x00, 0x41, 0x06, 0x41, 0x02, 0x41,
+    0x04, 0x42, 0x05, 0x41, 0x04, 0x42, 0x05, 0x41, 0x05, 0x41, 0x03, 0x41,
+    0x04, 0x42, 0x00, 0x4D, 0x00, 0x41, 0x05, 0x42, 0x02, 0x41, 0x04, 0x42,
+    0x02, 0x41, 0x02, 0x41, 0x04, 0x42, 0x02, 0x41, 0x02, 0x42, 0x03, 0x42,
+    0x03, 0x41, 0x04, 0x42, 0x02, 0x41, 0x00, 0x49, 0x00, 0x49, 0x01, 0x43,
+    0x04, 0x43, 0x02, 0x43, 0x04, 0x43, 0x05, 0x43, 0x04, 0x43, 0x04, 0x43,
+    0x02, 0x41, 0x00, 0xE2, 0x01, 0x41, 0x00, 0x68, 0x00, 0x44, 0x01, 0x41,
+    0x02, 0x49, 0x06, 0x41, 0x09, 0x44, 0x02, 0x41, 0x01, 0x43, 0x04, 0x43,
+    0x00, 0x4C, 0x00, 0x42, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x03, 0x41,
+    0x03, 0x41, 0x05, 0x41, 0x01, 0x41, 0x07, 0x41, 0x04, 0x41, 0x01, 0x41,
+    0x02, 0x41, 0x05, 0x41, 0x00, 0x4E, 0x00, 0x41, 0x04, 0x42, 0x01, 0x41,
+    0x04, 0x41, 0x03, 0x41, 0x04, 0x41, 0x02, 0x41, 0x06, 0x41, 0x06, 0x42,
+    0x02, 0x41, 0x04, 0x41, 0x00, 0x4F, 0x00, 0x41, 0x05, 0x41, 0x06, 0x41,
+    0x08, 0x41, 0x02, 0x41, 0x05, 0x41, 0x08, 0x41, 0x02, 0x41, 0x03, 0x41,
+    0x00, 0x50, 0x00, 0x42, 0x0B, 0x41, 0x08, 0x41, 0x03, 0x41, 0x04, 0x41,
+    0x0B, 0x41, 0x02, 0x41, 0x00, 0x53, 0x00, 0x44, 0x07, 0x41, 0x07, 0x41,
+    0x04, 0x41, 0x04, 0x41, 0x0B, 0x45, 0x00, 0x55, 0x00, 0x42, 0x06, 0x41,
+    0x08, 0x45, 0x04, 0x41, 0x0B, 0x41, 0x03, 0x41, 0x00, 0x50, 0x00, 0x41,
+    0x05, 0x41, 0x06, 0x41, 0x07, 0x41, 0x04, 0x42, 0x03, 0x41, 0x08, 0x41,
+    0x02, 0x41, 0x04, 0x41, 0x00, 0x4F, 0x00, 0x41, 0x05, 0x41, 0x06, 0x41,
+    0x06, 0x41, 0x06, 0x41, 0x04, 0x41, 0x07, 0x41, 0x02, 0x41, 0x05, 0x41,
+    0x00, 0x4E, 0x00, 0x42, 0x03, 0x42, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41,
+    0x05, 0x41, 0x04, 0x42, 0x03, 0x41, 0x05, 0x42, 0x00, 0x4D, 0x00, 0x41,
+    0x01, 0x44, 0x05, 0x45, 0x03, 0x43, 0x04, 0x44, 0x04, 0x45, 0x03, 0x43,
+    0x04, 0x43, 0x00, 0x3D, 0x02, 0x43, 0x04, 0x43, 0x05, 0x43, 0x01, 0x48,
+    0x02, 0x46, 0x06, 0x48, 0x02, 0x44, 0x07, 0x43, 0x04, 0x43, 0x03, 0x43,
+    0x03, 0x43, 0x2A, 0x42, 0x03, 0x42, 0x03, 0x41, 0x07, 0x41, 0x03, 0x41,
+    0x06, 0x41, 0x02, 0x41, 0x04, 0x42, 0x05, 0x41, 0x05, 0x41, 0x03, 0x41,
+    0x07, 0x42, 0x03, 0x42, 0x03, 0x41, 0x05, 0x41, 0x05, 0x41, 0x2B, 0x41,
+    0x05, 0x41, 0x04, 0x41, 0x05, 0x41, 0x04, 0x41, 0x06, 0x41, 0x02, 0x41,
+    0x05, 0x41, 0x05, 0x41, 0x06, 0x41, 0x02, 0x41, 0x07, 0x41, 0x05, 0x41,
+    0x04, 0x41, 0x04, 0x42, 0x03, 0x41, 0x2B, 0x41, 0x07, 0x41, 0x03, 0x41,
+    0x05, 0x41, 0x04, 0x41, 0x03, 0x41, 0x05, 0x41, 0x04, 0x42, 0x05, 0x41,
+    0x03, 0x41, 0x05, 0x41, 0x06, 0x41, 0x07, 0x41, 0x03, 0x41, 0x03, 0x41,
+    0x01, 0x41, 0x03, 0x41, 0x2B, 0x41, 0x07, 0x41, 0x04, 0x41, 0x03, 0x41,
+    0x05, 0x45, 0x05, 0x45, 0x07, 0x45, 0x05, 0x41, 0x06, 0x41, 0x07, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x2B, 0x41, 0x07, 0x41,
+    0x04, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x42,
+    0x06, 0x41, 0x03, 0x41, 0x05, 0x41, 0x06, 0x41, 0x07, 0x41, 0x04, 0x41,
+    0x02, 0x41, 0x01, 0x42, 0x01, 0x41, 0x2C, 0x41, 0x07, 0x41, 0x04, 0x42,
+    0x02, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x04, 0x41, 0x06, 0x41,
+    0x03, 0x41, 0x05, 0x41, 0x06, 0x41, 0x07, 0x41, 0x04, 0x41, 0x01, 0x41,
+    0x03, 0x41, 0x01, 0x41, 0x2C, 0x41, 0x07, 0x41, 0x05, 0x41, 0x01, 0x41,
+    0x06, 0x41, 0x06, 0x41, 0x02, 0x41, 0x04, 0x42, 0x05, 0x41, 0x09, 0x41,
+    0x06, 0x41, 0x07, 0x41, 0x04, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41,
+    0x2D, 0x41, 0x05, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x06, 0x41,
+    0x02, 0x41, 0x04, 0x42, 0x05, 0x41, 0x09, 0x41, 0x04, 0x41, 0x02, 0x41,
+    0x05, 0x41, 0x06, 0x42, 0x03, 0x42, 0x2E, 0x42, 0x03, 0x42, 0x07, 0x41,
+    0x07, 0x41, 0x05, 0x42, 0x02, 0x41, 0x04, 0x42, 0x02, 0x41, 0x02, 0x41,
+    0x09, 0x41, 0x04, 0x41, 0x02, 0x42, 0x03, 0x42, 0x06, 0x41, 0x05, 0x41,
+    0x30, 0x43, 0x09, 0x41, 0x06, 0x49, 0x01, 0x43, 0x04, 0x43, 0x02, 0x44,
+    0x06, 0x47, 0x04, 0x43, 0x08, 0x41, 0x05, 0x41, 0x00, 0x19, 0x22,
+};
+
+const RleImage kScreenArt[ART_COUNT] = {
+    { { 0x0000, 0xF800, 0x0000, 0x0000 }, sizeof(kKilData), kKilData },   // ART_KIL
+    { { 0x0000, 0x0400, 0x0000, 0x0000 }, sizeof(kWinData), kWinData },   // ART_WIN
+    { { 0x001F, 0xFFFF, 0x0000, 0x0000 }, sizeof(kOverflowData), kOverflowData },   // ART_OVERFLOW
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "lcd_dirty.h"
+
+// The fixed part of the kil, win and overflow screens (background and big
+// text), compressed into flash. screen_art.cpp is generated on the host by
+// host/gen_screens from DrawScreenArt(), so the images are exactly what
+// grlib would draw. The screens expand these and only draw the scores.
+
+typedef enum {
+    ART_KIL,
+    ART_WIN,
+    ART_OVERFLOW,
+    ART_COUNT
+} ScreenArt;
+
+extern const RleImage kScreenArt[ART_COUNT];
+
+// Draw an image with grlib into the frame buffer (display.cpp): what
+// gen_screens encodes, and the fallback while an image is empty.
+void DrawScreenArt(ScreenArt art);
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+
+// Small per-game PRNG (xorshift32). Pure 32-bit integer math, so a given
+// seed produces the same sequence on the board and on a host build, and
+// each GameEngine carries its own 4 bytes of state instead of sharing
+// libc rand().
+class SnekRng {
+public:
+    explicit SnekRng(uint32_t s = 1) { seed(s); }
+
+    void seed(uint32_t seed)
+    {
+        // Scramble the seed (murmur3 finalizer) so nearby seeds such as
+        // consecutive timer values start far apart; xorshift must not be 0.
+        seed ^= seed >> 16; seed *= 0x85EBCA6Bu;
+        seed ^= seed >> 13; seed *= 0xC2B2AE35u;
+        seed ^= seed >> 16;
+        state = seed ? seed : 0x9E3779B9u;
+    }
+
+    uint32_t next(void)
+    {
+        uint32_t x = state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        state = x;
+        return x;
+    }
+
+    // Unbiased draw in [0, n), n > 0. Lemire's multiply-shift: the high
+    // word of next() * n is the result, and draws whose low word falls in
+    // the short biased zone are rejected. The modulo that sizes that zone
+    // only runs when low < n, i.e. almost never for a game-sized n.
+    uint32_t below(uint32_t n)
+    {
+        uint64_t m   = (uint64_t)next() * n;
+        uint32_t low = (uint32_t)m;
+        if (low < n) {
+            uint32_t threshold = (uint32_t)(0u - n) % n;
+            while (low < threshold) {
+                m   = (uint64_t)next() * n;
+                low = (uint32_t)m;
+            }
+        }
+        return (uint32_t)(m >> 32);
+    }
+
+    // Raw generator state, for game snapshots
+    uint32_t raw(void) const   { return state; }
+    void     setRaw(uint32_t s) { state = s; }
+
+private:
+    uint32_t state;
+};
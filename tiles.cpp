@@ -0,0 +1,16 @@
+#include <stdint.h>
+
+#include "tiles.h"
+
+// Four pixels of palette index c in one word
+#define TILE_QUAD(c) ((uint32_t)(c) * 0x01010101u)
+#define TILE_ROW(c)  { TILE_QUAD(c), TILE_QUAD(c) }
+#define TILE_FLAT(c) { { TILE_ROW(c), TILE_ROW(c), TILE_ROW(c), TILE_ROW(c), \
+                         TILE_ROW(c), TILE_ROW(c), TILE_ROW(c), TILE_ROW(c) } }
+
+const Tile8 kCellTiles[TILE_COUNT] = {
+    TILE_FLAT(LCD_BLACK),    // TILE_EMPTY
+    TILE_FLAT(LCD_YELLOW),   // TILE_BODY
+    TILE_FLAT(LCD_GREEN),    // TILE_HEAD
+    TILE_FLAT(LCD_RED),      // TILE_FRUIT
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "lcd_dirty.h"
+
+// Cell sprites for boards with 8x8-pixel cells (the 16x16 grid), already
+// as screen palette indices so drawing one is a plain copy (LCD_BlitTile8).
+// Indexed by the CELL_* kinds in display.cpp, in the same order. The
+// tiles are flat fills in the old cell colors; any 8x8 art can replace
+// them at no extra cost per frame.
+enum { TILE_EMPTY, TILE_BODY, TILE_HEAD, TILE_FRUIT, TILE_COUNT };
+
+extern const Tile8 kCellTiles[TILE_COUNT];
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+// Hands a value too big to store atomically (the state the renderer draws)
+// from one writer task to one reader task without either waiting on the
+// other. Three slots: the last one published, the one the reader holds,
+// and the one the writer is filling. The writer never picks the reader's
+// slot, so a read is never torn.
+//
+// Each side only stores its own index, so there is no read-modify-write:
+// the reader marks the slot it takes, then re-checks that it is still the
+// newest; if the writer moved on in between it takes the newer one. That
+// loop only repeats if the writer publishes while the reader is between
+// the two loads. No RTOS calls.
+
+template <class T>
+class TripleBuffer {
+public:
+    TripleBuffer() : published(0), reading(0), writing(1) {}
+
+    // Writer: fill back(), then publish() it
+    T* back(void) { return &slots[writing]; }
+
+    void publish(void)
+    {
+        published.store(writing);
+        // Next slot: neither the one just published nor the reader's
+        uint8_t r = reading.load();
+        uint8_t w = 0;
+        while (w == writing || w == r) w++;
+        writing = w;
+    }
+
+    // Reader: the newest published slot. It stays as it is until the next
+    // acquire(). Before the first publish() this is a default T.
+    const T* acquire(void)
+    {
+        uint8_t p;
+        do {
+            p = published.load();
+            reading.store(p);
+        } while (published.load() != p);
+        return &slots[p];
+    }
+
+private:
+    T slots[3];
+    std::atomic<uint8_t> published;   // written by the writer only
+    std::atomic<uint8_t> reading;     // written by the reader only
+    uint8_t writing;                  // writer's private slot
+};